@@ -0,0 +1,66 @@
+import argparse
+import re
+import subprocess
+import sys
+import time
+
+# Rows of the CDCL statistics table: "c <Solver> <id>,<Conflicts>,..."
+STATS_ROW = re.compile(r"^c\s+(\S+ \d+),(\d+),(\d+),")
+
+
+def run(painless, cnf, cpus, timeout, placement, extra):
+    command = [painless, f"-c={cpus}", f"-t={timeout}",
+               f"-placement={placement}", *extra, cnf]
+    start = time.monotonic()
+    output = subprocess.run(command, capture_output=True, text=True).stdout
+    elapsed = time.monotonic() - start
+
+    conflicts = 0
+    for line in output.splitlines():
+        match = STATS_ROW.match(line)
+        if match:
+            conflicts += int(match.group(2))
+    return conflicts, elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare the conflicts per second of painless with and "
+                    "without solver pinning (-placement)")
+    parser.add_argument("painless", help="painless binary")
+    parser.add_argument("cnfs", nargs="+", help="hard formulas (the runs "
+                        "should reach the timeout)")
+    parser.add_argument("-c", "--cpus", type=int, default=0,
+                        help="solver threads (0: all the cpus)")
+    parser.add_argument("-t", "--timeout", type=int, default=60)
+    parser.add_argument("-r", "--runs", type=int, default=3)
+    parser.add_argument("-p", "--policies", nargs="+",
+                        default=["none", "compact", "scatter"])
+    parser.add_argument("--extra", nargs=argparse.REMAINDER, default=[],
+                        help="further painless options")
+    args = parser.parse_args()
+
+    print("formula,placement,run,conflicts,seconds,conflicts/s")
+    totals = {policy: [0, 0.0] for policy in args.policies}
+    for cnf in args.cnfs:
+        for run_id in range(args.runs):
+            # Interleave the policies so machine noise hits them alike
+            for policy in args.policies:
+                conflicts, elapsed = run(args.painless, cnf, args.cpus,
+                                         args.timeout, policy, args.extra)
+                totals[policy][0] += conflicts
+                totals[policy][1] += elapsed
+                print(f"{cnf},{policy},{run_id},{conflicts},{elapsed:.1f},"
+                      f"{conflicts / elapsed:.0f}", flush=True)
+
+    baseline = totals[args.policies[0]]
+    baseline_rate = baseline[0] / baseline[1] if baseline[1] else 0
+    print("\nplacement,conflicts/s,speedup", file=sys.stderr)
+    for policy, (conflicts, elapsed) in totals.items():
+        rate = conflicts / elapsed if elapsed else 0
+        speedup = rate / baseline_rate if baseline_rate else 0
+        print(f"{policy},{rate:.0f},{speedup:.2f}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
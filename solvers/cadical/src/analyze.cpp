@@ -229,6 +229,13 @@ inline void Internal::bump_clause (Clause *c) {
     return;
   if (!c->redundant)
     return;
+  // Begin Painless
+  if (c->imported) {
+    c->imported = false;
+    if (external->learner)
+      external->export_used_imported_clause (c);
+  }
+  // End Painless
   int new_glue = recompute_glue (c);
   if (new_glue < c->glue)
     promote_clause (c, new_glue);
@@ -954,6 +954,25 @@ public:
 
   // Begin Painless
   Stats *getStatistics ();
+  // Number of active variables, callable while solving (from the learner).
+  int getActiveVariables () const;
+  // For each external variable 1..vars, sets bit 0 (resp. 1) of states[v]
+  // if an imported clause containing v (resp. -v) would be dropped:
+  // eliminated, substituted, witness or root satisfied literal. To be
+  // called at root level (from the learner import callbacks).
+  void getImportRejectedLiterals (unsigned char *states, int vars) const;
+  // For each external variable 1..vars, sets phases[v] to its best phase
+  // (source 0), target phase (1) or saved phase (2) as 1 or -1, 0 if it is
+  // not set yet or the variable is unknown. The phases set by savePhase are
+  // only found in the saved ones. To be called from the learner import
+  // callbacks.
+  void getPhases (signed char *phases, int vars, int source) const;
+  // Sets the saved phase of an active variable to the sign of 'lit', the
+  // other variables (unknown, fixed, eliminated, substituted) are skipped
+  // and false is returned. Unlike 'savePhase' it does not internalize the
+  // literal, so it can be called during the search (from the learner
+  // import callbacks).
+  bool setPhaseHint (int lit);
   // End Painless
   void statistics (); // Print statistics.
   void resources ();  // Print resource usage (time and memory).
@@ -1240,14 +1259,21 @@ public:
 class Learner {
 public:
   virtual ~Learner () {}
-  // Export
-  virtual bool
-  learning (int size,
-            int glue) = 0; // Painless Modification for glue support
-  virtual void learn (int lit) = 0;
-  // Import
+  // Export: 'learning' returns a buffer of 'size' literals (0 to skip the
+  // clause) in which the solver writes the external literals before
+  // handing the whole clause back with 'learned'.
+  virtual int *learning (int size, int glue) = 0;
+  virtual void learned () = 0;
+  // Import: 'lits' points to 'size' external literals owned by the
+  // learner, valid until the next call to 'hasClauseToImport'.
   virtual bool hasClauseToImport () = 0;
-  virtual void getClauseToImport (std::vector<int> &clause, int &glue) = 0;
+  virtual void getClauseToImport (const int *&lits, int &size,
+                                  int &glue) = 0;
+  // Feedback: an imported redundant clause took part in conflict analysis
+  // for the first time ('lits' only valid during the call).
+  virtual void usedImportedClause (const int *lits, int size) {
+    (void) lits, (void) size;
+  }
 };
 
 // End Painless
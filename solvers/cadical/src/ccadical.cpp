@@ -28,37 +28,34 @@ struct Wrapper : Learner, Terminator {
   }
 
   // Begin Painless
-  bool learning (int size, int) {
-    // End Painless
-    if (!learner.function)
-      return false;
-    return size <= learner.max_length;
-  }
-
-  void learn (int lit) {
-    if (learner.end_clause == learner.capacity_clause) {
-      size_t count = learner.end_clause - learner.begin_clause;
-      size_t size = count ? 2 * count : 1;
+  int *learning (int size, int) {
+    if (!learner.function || size > learner.max_length)
+      return 0;
+    // Room for the literals and the terminating zero
+    const size_t needed = (size_t) size + 1;
+    if ((size_t) (learner.capacity_clause - learner.begin_clause) <
+        needed) {
       learner.begin_clause =
-          (int *) realloc (learner.begin_clause, size * sizeof (int));
-      learner.end_clause = learner.begin_clause + count;
-      learner.capacity_clause = learner.begin_clause + size;
+          (int *) realloc (learner.begin_clause, needed * sizeof (int));
+      learner.capacity_clause = learner.begin_clause + needed;
     }
-    *learner.end_clause++ = lit;
-    if (lit)
-      return;
+    learner.end_clause = learner.begin_clause + size;
+    return learner.begin_clause;
+  }
+
+  void learned () {
+    *learner.end_clause = 0;
     learner.function (learner.state, learner.begin_clause);
     learner.end_clause = learner.begin_clause;
   }
 
-  // Begin Painless
   bool hasClauseToImport () {
     assert (false &&
             "hasClauseToImport is not implemented in this C Wrapper");
     return false;
   }
 
-  void getClauseToImport (std::vector<int> &, int &) {
+  void getClauseToImport (const int *&, int &, int &) {
     assert (false &&
             "getClauseToImport is not implemented in this C Wrapper");
   }
@@ -107,6 +107,9 @@ Clause *Internal::new_clause (bool red, int glue) {
   c->flushed = false;
   c->vivified = false;
   c->vivify = false;
+  // Begin Painless
+  c->imported = false;
+  // End Painless
   c->used = 0;
 
   c->glue = glue;
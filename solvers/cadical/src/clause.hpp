@@ -57,6 +57,9 @@ struct Clause {
   bool flushed : 1;      // garbage in proof deleted binaries
   bool vivified : 1;     // clause already vivified
   bool vivify : 1;       // clause scheduled to be vivified
+  // Begin Painless
+  bool imported : 1; // shared clause not yet used in conflict analysis
+  // End Painless
 
   // The glucose level ('LBD' or short 'glue') is a heuristic value for the
   // expected usefulness of a learned clause, where smaller glue is consider
@@ -1005,21 +1005,22 @@ void External::copy_flags (External &other) const {
 // Begin Painless
 void External::export_learned_empty_clause () {
   assert (learner);
-  if (learner->learning (0,0)) {
+  if (learner->learning (0, 0)) {
     LOG ("exporting learned empty clause");
-    learner->learn (0);
+    learner->learned ();
   } else
     LOG ("not exporting learned empty clause");
 }
 
 void External::export_learned_unit_clause (int ilit) {
   assert (learner);
-  if (learner->learning (1,0)) {
+  int *lits = learner->learning (1, 0);
+  if (lits) {
     LOG ("exporting learned unit clause");
     const int elit = internal->externalize (ilit);
     assert (elit);
-    learner->learn (elit);
-    learner->learn (0);
+    lits[0] = elit;
+    learner->learned ();
   } else
     LOG ("not exporting learned unit clause");
 }
@@ -1029,17 +1030,32 @@ void External::export_learned_large_clause (const vector<int> &clause) {
   int glue = clause.back ();
   size_t size = clause.size () - 1; // do not count glue value
   assert (size <= (unsigned) INT_MAX);
-  if (learner->learning ((int) size, glue)) {
+  int *lits = learner->learning ((int) size, glue);
+  if (lits) {
     LOG ("exporting learned clause of size %zu", size);
-    for (auto ilit : clause) {
-      const int elit = internal->externalize (ilit);
+    for (size_t i = 0; i < size; i++) {
+      const int elit = internal->externalize (clause[i]);
       assert (elit);
-      learner->learn (elit);
+      lits[i] = elit;
     }
-    learner->learn (0);
+    learner->learned ();
   } else
     LOG ("not exporting learned clause of size %zu", size);
 }
+
+void External::export_used_imported_clause (const Clause *c) {
+  assert (learner);
+  assert (used_imported.empty ());
+  for (const auto &ilit : *c) {
+    const int elit = internal->externalize (ilit);
+    assert (elit);
+    used_imported.push_back (elit);
+  }
+  LOG (c, "reporting used imported");
+  learner->usedImportedClause (used_imported.data (),
+                               (int) used_imported.size ());
+  used_imported.clear ();
+}
 // End Painless
 
 
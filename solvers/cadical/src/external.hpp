@@ -101,6 +101,11 @@ struct External {
   void export_learned_unit_clause (int ilit);
   void export_learned_large_clause (const vector<int> &);
 
+  // Literals of an imported clause reported through 'usedImportedClause'.
+
+  vector<int> used_imported;
+  void export_used_imported_clause (const Clause *);
+
   // If there is a listener for fixed assignments.
 
   FixedAssignmentListener *fixed_listener;
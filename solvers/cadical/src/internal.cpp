@@ -451,22 +451,23 @@ void Internal::import_redundant_clauses (int &res) {
   if (res != 0)
     return;
 
-  std::vector<int> externClause (0);
   std::vector<int> &internClause = this->clause;
 
   assert (internClause.empty ());
+  const int *externLits;
+  int externSize;
   int glue;
   int unitClause;
   while (external->learner->hasClauseToImport ()) {
-    externClause.clear ();
-    external->learner->getClauseToImport (externClause, glue);
+    external->learner->getClauseToImport (externLits, externSize, glue);
     unitClause = 0;
-    assert (externClause.size () > 0);
+    assert (externSize > 0);
     assert (glue >= 0);
 
     // Check if the clause can be imported
     bool addClause = true;
-    for (auto externLit : externClause) {
+    for (int i = 0; i < externSize; i++) {
+      const int externLit = externLits[i];
       assert (externLit != 0);
       if (external->marked (external->witness, externLit)) {
         // Literal marked as witness: Cannot import
@@ -506,6 +507,7 @@ void Internal::import_redundant_clauses (int &res) {
       CaDiCaL::Clause *ref = new_clause (
           glue > 0,
           glue); // if glue == 0, clause is irredundant (permanent)
+      ref->imported = ref->redundant;
       if (proof)
         proof->add_derived_clause (ref,
                                    {}); // lrat_chain can be also share for
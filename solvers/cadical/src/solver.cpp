@@ -1432,6 +1432,55 @@ void Solver::configurations () { Config::usage (); }
 
 // Begin Painless
 Stats *Solver::getStatistics () { return &(this->internal->stats); }
+
+int Solver::getActiveVariables () const { return internal->active (); }
+
+void Solver::getImportRejectedLiterals (unsigned char *states,
+                                        int vars) const {
+  for (int eidx = 1; eidx <= vars; eidx++) {
+    unsigned char state = 0;
+    const int ilit = eidx <= external->max_var ? external->e2i[eidx] : 0;
+    if (ilit) {
+      const Flags &f = internal->flags (ilit);
+      if (f.eliminated () || f.substituted ())
+        state = 3;
+      else if (internal->fixed (ilit))
+        state = internal->fixed (ilit) > 0 ? 1 : 2;
+      if (external->marked (external->witness, eidx))
+        state |= 1;
+      if (external->marked (external->witness, -eidx))
+        state |= 2;
+    }
+    states[eidx] = state;
+  }
+}
+
+void Solver::getPhases (signed char *phases, int vars, int source) const {
+  const std::vector<signed char> &preferred =
+      source == 0   ? internal->phases.best
+      : source == 1 ? internal->phases.target
+                    : internal->phases.saved;
+  for (int eidx = 1; eidx <= vars; eidx++) {
+    signed char phase = 0;
+    const int ilit = eidx <= external->max_var ? external->e2i[eidx] : 0;
+    if (ilit) {
+      const int iidx = abs (ilit);
+      phase = preferred[iidx];
+      if (ilit < 0)
+        phase = -phase;
+    }
+    phases[eidx] = phase;
+  }
+}
+
+bool Solver::setPhaseHint (int lit) {
+  const int eidx = abs (lit);
+  const int ilit = eidx <= external->max_var ? external->e2i[eidx] : 0;
+  if (!ilit || !internal->active (ilit))
+    return false;
+  internal->phases.saved[abs (ilit)] = (lit < 0) == (ilit < 0) ? 1 : -1;
+  return true;
+}
 // End Painless
 
 void Solver::statistics () {
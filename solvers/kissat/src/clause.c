@@ -42,6 +42,9 @@ static void init_clause (clause *res, bool redundant, unsigned glue,
   res->subsume = false;
   res->swept = false;
   res->vivify = false;
+  // Begin Painless
+  res->imported = false;
+  // End Painless
 
   res->used = 0;
 
@@ -10,7 +10,9 @@
 
 typedef struct clause clause;
 
-#define LD_MAX_GLUE 19
+// Begin Painless (one glue bit for the imported flag)
+#define LD_MAX_GLUE 18
+// End Painless
 #define LD_MAX_USED 5
 
 #define MAX_GLUE ((1u << LD_MAX_GLUE) - 1)
@@ -27,6 +29,9 @@ struct clause {
   bool subsume : 1;
   bool swept : 1;
   bool vivify : 1;
+  // Begin Painless
+  bool imported : 1; // shared clause not yet used in a conflict
+  // End Painless
 
   unsigned used : LD_MAX_USED;
 
@@ -2,6 +2,9 @@
 #include "inline.h"
 #include "promote.h"
 #include "strengthen.h"
+// Begin Painless
+#include "learn.h"
+// End Painless
 
 static inline void recompute_and_promote (kissat *solver, clause *c) {
   assert (c->redundant);
@@ -17,6 +20,10 @@ static inline void mark_clause_as_used (kissat *solver, clause *c) {
   INC (clauses_used);
   c->used = MAX_USED;
   LOGCLS (c, "using");
+  // Begin Painless
+  if (c->imported)
+    kissat_report_used_pclause (solver, c);
+  // End Painless
   recompute_and_promote (solver, c);
   unsigned glue = MIN (c->glue, MAX_GLUE_USED);
   solver->statistics.used[solver->stable].glue[glue]++;
@@ -44,6 +44,7 @@ kissat *kissat_init (void) {
   kissat_reset_last_learned (solver);
   // Begin Painless
   INIT_STACK (solver->pclause);
+  INIT_STACK (solver->pused);
   // End Painless
 #ifndef NDEBUG
   kissat_init_checker (solver);
@@ -108,6 +109,7 @@ void kissat_release (kissat *solver) {
   RELEASE_STACK (solver->clause);
   // Begin Painless
   RELEASE_STACK (solver->pclause);
+  RELEASE_STACK (solver->pused);
   // End Painless
   RELEASE_STACK (solver->shadow);
 #if defined(LOGGING) || !defined(NDEBUG)
@@ -115,6 +115,8 @@ struct kissat {
   unsigned char (*cbkHasClauseToImport)(void*);
 	unsigned char (*cbkImportClause)(void*);
 	char (*cbkExportClause)(void*); 
+  void (*cbkImportedClauseUsed)(void*, const int*, unsigned);
+  ints pused; // external literals of the used imported clause
 	// End Painless
 
   ints export;
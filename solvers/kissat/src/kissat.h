@@ -62,6 +62,8 @@ void kissat_get_main_statistics (kissat *solver, KissatMainStatistics *);
 void kissat_set_import_check (kissat *, unsigned char (*) (void *));
 void kissat_set_import_call (kissat *, unsigned char (*) (void *));
 void kissat_set_export_call (kissat *, char (*) (void *));
+void kissat_set_used_import_call (kissat *,
+                                  void (*) (void *, const int *, unsigned));
 void kissat_set_painless (kissat *, void *);
 void kissat_set_id (kissat *, int);
 
@@ -71,12 +73,30 @@ unsigned char kissat_import_pclause (kissat *, const int *, unsigned);
 /* This function assigns units directly, which is dangerous outside of level
  * = 0*/
 int kissat_assign_punits (kissat *, int *, unsigned);
+/* Imports count clauses at root level: sizes[i] literals of external_lits
+ * and glue glues[i] (0 for irredundant) for the i-th clause. Returns 20 if
+ * an empty clause is derived, 0 otherwise.*/
+int kissat_import_pclauses (kissat *, const int *, const unsigned *,
+                            const unsigned *, unsigned);
+/* Number of active (neither fixed nor eliminated) variables */
+unsigned kissat_get_active (kissat *);
+/* Sets bit 0 (resp. 1) of states[v] for the external variables 1..vars if
+ * an imported clause with v (resp. -v) would be rejected: eliminated
+ * variable or literal satisfied at root level */
+void kissat_get_import_rejected_plits (kissat *, unsigned char *, unsigned);
 
 void kissat_set_pglue (kissat *, unsigned);
 unsigned kissat_get_pglue (kissat *);
 
 // Interface inner functions
 char kissat_set_phase (kissat *, unsigned, int);
+/* Sets the saved phase only: the best and target phases, which
+ * kissat_get_phases publishes, are left to the search */
+char kissat_set_phase_hint (kissat *, unsigned, int);
+/* Sets phases[v] for the external variables 1..vars to their best phase
+ * (source 0), target phase (1) or saved phase (2), 0 if not set yet,
+ * unknown or eliminated */
+void kissat_get_phases (kissat *, signed char *, unsigned, int);
 /* to not have an abort from kissat */
 char kissat_check_searches (kissat *);
 unsigned kissat_get_var_count (kissat *);
@@ -257,6 +257,91 @@ bool kissat_external_learning (struct kissat *solver) {
   return 0 == solver->level && NULL != solver->cbkHasClauseToImport &&
          solver->cbkHasClauseToImport (solver->painless);
 }
+/**
+ * Attaches the clause in solver->clause (unassigned internal literals) with
+ * glue solver->pglue (0 for an irredundant clause). Returns 20 if the clause
+ * is empty, 0 otherwise. Must be called at root level.
+ */
+int kissat_learn_pclause (kissat *solver) {
+  assert (!solver->level);
+
+  unsigned size = SIZE_STACK (solver->clause);
+
+  if (size == 0) {
+    LOGP ("The solver %d received an empty clause. Returns UNSAT!",
+          solver->id_painless);
+    return 20;
+  } else if (size == 1) {
+    /* Only one unassigned */
+    LOGP ("The solver %d received a clause with only one unassigned "
+          "internal literal %d.",
+          solver->id_painless, PEEK_STACK (solver->clause, 0));
+    INC (clauses_imported_s1);
+    kissat_assign_unit (solver, PEEK_STACK (solver->clause, 0),
+                        "painless reason");
+  } else if (size == 2) {
+    /* Inspired by learn_binary */
+    LOGP ("The solver %d received a clause with only two unassigned "
+          "internal literals.",
+          solver->id_painless);
+
+    reference new_clause_ref;
+
+    if (solver->pglue == 0)
+      new_clause_ref = kissat_new_irredundant_clause (solver);
+    else
+      new_clause_ref = kissat_new_redundant_clause (solver, 1);
+
+    if (new_clause_ref != INVALID_REF) {
+      /*Since binaries are stored directly in watch lists*/
+      kissat_fatal ("Couldn't import a binary clause");
+    }
+    INC (clauses_imported_s2);
+  } else {
+    /* Else: size > 2*/
+    /*Inspired by learn_reference*/
+    LOGP ("The solver %d received a clause with %d unassigned internal "
+          "literal.",
+          solver->id_painless, size);
+
+    reference new_clause_ref;
+
+    if (solver->pglue == 0)
+      new_clause_ref = kissat_new_irredundant_clause (solver);
+    else
+      new_clause_ref = kissat_new_redundant_clause (solver, solver->pglue);
+
+    if (new_clause_ref == INVALID_REF) {
+      kissat_fatal ("Couldn't import a non binary clause");
+    }
+    if (solver->pglue)
+      kissat_dereference_clause (solver, new_clause_ref)->imported = true;
+    INC (clauses_imported_sL);
+  }
+  return 0;
+}
+
+/**
+ * Hands the external literals of an imported clause to the painless
+ * callback the first time the clause is used in conflict analysis.
+ */
+void kissat_report_used_pclause (kissat *solver, clause *c) {
+  assert (c->imported);
+  c->imported = false;
+  if (!solver->cbkImportedClauseUsed)
+    return;
+  CLEAR_STACK (solver->pused);
+  for (all_literals_in_clause (lit, c)) {
+    const int elit = kissat_export_literal (solver, lit);
+    if (!elit)
+      return;
+    PUSH_STACK (solver->pused, elit);
+  }
+  solver->cbkImportedClauseUsed (solver->painless,
+                                 BEGIN_STACK (solver->pused),
+                                 SIZE_STACK (solver->pused));
+}
+
 /**
  * Callback checks before copying internal literals to solver->pclause:
  *  - if the clause contains an eliminated variable (ignores it)
@@ -278,58 +363,9 @@ int kissat_external_learn_clauses (kissat *solver) {
     if(max_glue && solver->pglue > max_glue)
       continue;
 
-    unsigned size = SIZE_STACK (solver->clause);
-
-    if (size == 0) {
-      LOGP ("The solver %d received an empty clause. Returns UNSAT!",
-            solver->id_painless);
+    if (kissat_learn_pclause (solver) == 20) {
       CLEAR_STACK (solver->clause);
       return 20;
-    } else if (size == 1) {
-      /* Only one unassigned */
-      LOGP ("The solver %d received a clause with only one unassigned "
-            "internal literal %d.",
-            solver->id_painless, PEEK_STACK (solver->clause, 0));
-      INC (clauses_imported_s1);
-      kissat_assign_unit (solver, PEEK_STACK (solver->clause, 0),
-                          "painless reason");
-    } else if (size == 2) {
-      /* Inspired by learn_binary */
-      LOGP ("The solver %d received a clause with only two unassigned "
-            "internal literals.",
-            solver->id_painless);
-
-      reference new_clause_ref;
-
-      if (solver->pglue == 0)
-        new_clause_ref = kissat_new_irredundant_clause (solver);
-      else
-        new_clause_ref = kissat_new_redundant_clause (solver, 1);
-
-      if (new_clause_ref != INVALID_REF) {
-        /*Since binaries are stored directly in watch lists*/
-        kissat_fatal ("Couldn't import a binary clause");
-      }
-      INC (clauses_imported_s2);
-    } else {
-      /* Else: size > 2*/
-      /*Inspired by learn_reference*/
-      LOGP ("The solver %d received a clause with %d unassigned internal "
-            "literal.",
-            solver->id_painless, size);
-
-      reference new_clause_ref;
-
-      if (solver->pglue == 0)
-        new_clause_ref = kissat_new_irredundant_clause (solver);
-      else
-        new_clause_ref =
-            kissat_new_redundant_clause (solver, solver->pglue);
-
-      if (new_clause_ref == INVALID_REF) {
-        kissat_fatal ("Couldn't import a non binary clause");
-      }
-      INC (clauses_imported_sL);
     }
   }
   CLEAR_STACK (solver->clause);
@@ -11,6 +11,9 @@ unsigned kissat_determine_new_level (struct kissat *, unsigned jump);
 #include <stdbool.h>
 int kissat_external_learn_clauses (struct kissat *);
 bool kissat_external_learning (struct kissat *);
+int kissat_learn_pclause (struct kissat *);
+struct clause;
+void kissat_report_used_pclause (struct kissat *, struct clause *);
 // End Painless
 
 #endif
@@ -5,6 +5,7 @@
 #include "statistics.h"
 
 #include "inline.h"
+#include "learn.h"
 
 // Core
 unsigned kissat_get_var_count (kissat *solver) { return solver->vars; }
@@ -162,6 +163,65 @@ unsigned char kissat_import_pclause (kissat *solver,
   return true;
 }
 
+int kissat_import_pclauses (kissat *solver, const int *external_lits,
+                            const unsigned *sizes, const unsigned *glues,
+                            unsigned count) {
+  assert (!solver->level);
+
+  LOGP ("Kissat %u Calling import_pclauses on %u clauses",
+        solver->id_painless, count);
+
+  const int max_glue = GET_OPTION (importmaxglue);
+  const unsigned saved_glue = solver->pglue;
+  int res = 0;
+
+  /* Each clause is simplified against the root assignment, including the
+   * units attached earlier in the batch, then attached. Propagation only
+   * resumes once the whole batch is in. */
+  for (unsigned c = 0; c < count; c++) {
+    const int *lits = external_lits;
+    external_lits += sizes[c];
+
+    if (max_glue && glues[c] > (unsigned) max_glue)
+      continue;
+    if (!kissat_import_pclause (solver, lits, sizes[c]))
+      continue;
+
+    solver->pglue = glues[c];
+    if (kissat_learn_pclause (solver) == 20) {
+      res = 20;
+      break;
+    }
+  }
+
+  CLEAR_STACK (solver->clause);
+  solver->pglue = saved_glue;
+  return res;
+}
+
+unsigned kissat_get_active (kissat *solver) { return solver->active; }
+
+void kissat_get_import_rejected_plits (kissat *solver,
+                                       unsigned char *states,
+                                       unsigned vars) {
+  /* Same checks as kissat_import_pclause: bit 0 (resp. 1) is set if the
+   * positive (resp. negative) literal makes a clause rejected. */
+  for (unsigned external_var = 1; external_var <= vars; external_var++) {
+    unsigned char state = 0;
+    if (external_var < SIZE_STACK (solver->import)) {
+      import *import_lit = &PEEK_STACK (solver->import, external_var);
+      if (import_lit->eliminated)
+        state = 3;
+      else if (import_lit->imported) {
+        value val = VALUE (import_lit->lit);
+        if (val)
+          state = val > 0 ? 1 : 2;
+      }
+    }
+    states[external_var] = state;
+  }
+}
+
 void kissat_print_sharing_stats (kissat *solver) {
   printf ("c----------[Kissat %d Stats]--------------\
     \nc General:\
@@ -202,6 +262,12 @@ void kissat_set_export_call (kissat *solver, char (*call) (void *)) {
   solver->cbkExportClause = call;
 }
 
+void kissat_set_used_import_call (kissat *solver,
+                                  void (*call) (void *, const int *,
+                                                unsigned)) {
+  solver->cbkImportedClauseUsed = call;
+}
+
 void kissat_set_painless (kissat *solver, void *painless_kissat) {
   solver->painless = painless_kissat;
 }
@@ -231,6 +297,39 @@ char kissat_set_phase (kissat *solver, unsigned external_var, int phase) {
   return true;
 }
 
+char kissat_set_phase_hint (kissat *solver, unsigned external_var,
+                            int phase) {
+  if (external_var >= SIZE_STACK (solver->import))
+    return false;
+  import *import_lit = &PEEK_STACK (solver->import, external_var);
+  if (!import_lit->imported || import_lit->eliminated)
+    return false;
+  if (NEGATED (import_lit->lit))
+    phase = -phase;
+  solver->phases.saved[IDX (import_lit->lit)] = phase;
+  return true;
+}
+
+void kissat_get_phases (kissat *solver, signed char *phases, unsigned vars,
+                        int source) {
+  const value *preferred = source == 0   ? solver->phases.best
+                           : source == 1 ? solver->phases.target
+                                         : solver->phases.saved;
+  for (unsigned external_var = 1; external_var <= vars; external_var++) {
+    signed char phase = 0;
+    if (external_var < SIZE_STACK (solver->import)) {
+      import *import_lit = &PEEK_STACK (solver->import, external_var);
+      if (import_lit->imported && !import_lit->eliminated) {
+        unsigned internal_var = IDX (import_lit->lit);
+        phase = preferred[internal_var];
+        if (NEGATED (import_lit->lit))
+          phase = -phase;
+      }
+    }
+    phases[external_var] = phase;
+  }
+}
+
 char kissat_check_searches (kissat *solver) {
   return kissat_get_searches (&solver->statistics) > 0;
 }
\ No newline at end of file
@@ -2648,7 +2648,8 @@ static void tass_pick_assignment(Yals *yals, int initial)
       yals->vals[i] = tass_rand(yals);
   }
   tass_remove_trailing_bits(yals);
-  if (initial)
+  /* Painless: phases set during the search are forced at the next restart */
+  if (initial || !EMPTY(yals->phases))
     tass_setphases(yals);
   tass_set_units(yals);
   if (yals->opts.verbose.val <= 2)
@@ -3451,6 +3452,11 @@ void tass_setphase(Yals *yals, int lit)
   PUSH(yals->phases, lit);
 }
 
+void tass_clearphases(Yals *yals)
+{
+  CLEAR(yals->phases);
+}
+
 void tass_setflipslimit(Yals *yals, long long flips)
 {
   yals->limits.flips = flips;
@@ -3812,7 +3818,9 @@ void tass_restart_inner(Yals *yals)
   if ((tass_inc_inner_restart_interval(yals) && yals->opts.verbose.val) ||
       yals->opts.verbose.val >= 2)
     tass_report(yals, "restart %lld", yals->stats.restart.inner.count);
-  if (!yals->force_restart && yals->stats.best < yals->stats.last)
+  /* Painless: forced phases (guided restart) are not skipped */
+  if (!yals->force_restart && yals->stats.best < yals->stats.last &&
+      EMPTY(yals->phases))
   {
     yals->stats.pick.keep++;
     tass_msg(yals, 2,
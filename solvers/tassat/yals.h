@@ -46,6 +46,8 @@ tass_setout(Yals*, FILE*);
 void
 tass_setphase(Yals*, int lit);
 void
+tass_clearphases(Yals*);
+void
 tass_setflipslimit(Yals*, long long);
 void
 tass_setmemslimit(Yals*, long long);
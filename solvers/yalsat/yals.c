@@ -1909,7 +1909,8 @@ static void yals_pick_assignment (Yals * yals, int initial) {
       yals->vals[i] = yals_rand (yals);
   }
   yals_remove_trailing_bits (yals);
-  if (initial) yals_setphases (yals);
+  /* Painless: phases set during the search are forced at the next restart */
+  if (initial || !EMPTY (yals->phases)) yals_setphases (yals);
   yals_set_units (yals);
   if (yals->opts.verbose.val <= 2) return;
   pos = neg = 0;
@@ -2580,6 +2581,8 @@ void yals_setphase (Yals * yals, int lit) {
   PUSH (yals->phases, lit);
 }
 
+void yals_clearphases (Yals * yals) { CLEAR (yals->phases); }
+
 void yals_setflipslimit (Yals * yals, long long flips) {
   yals->limits.flips = flips;
   yals_msg (yals, 1, "new flips limit %lld", (long long) flips);
@@ -2858,7 +2861,8 @@ static void yals_restart_inner (Yals * yals) {
   if ((yals_inc_inner_restart_interval (yals) && yals->opts.verbose.val) ||
       yals->opts.verbose.val >= 2)
     yals_report (yals, "restart %lld", yals->stats.restart.inner.count);
-  if (yals->stats.best < yals->stats.last) {
+  /* Painless: forced phases (guided restart) are not skipped */
+  if (yals->stats.best < yals->stats.last && EMPTY (yals->phases)) {
     yals->stats.pick.keep++;
     yals_msg (yals, 2,
       "keeping strategy and assignment thus essentially skipping restart");
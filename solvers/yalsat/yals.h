@@ -39,6 +39,8 @@ yals_setout(Yals*, FILE*);
 void
 yals_setphase(Yals*, int lit);
 void
+yals_clearphases(Yals*);
+void
 yals_setflipslimit(Yals*, long long);
 void
 yals_setmemslimit(Yals*, long long);
@@ -52,6 +52,8 @@ createPermanentWorkersFromParameters(PainlessImpl& painless)
     parameters.cpus, 's', parameters.solver, fullReader, solvers);
   LOG1("Created all the required solvers");
 
+  SolverFactory::placeSolvers(parameters.placement, solvers);
+
   std::shared_ptr<WorkingStrategy> mainStrategy =
     WorkingStrategyRegistry::create(
       parameters.parallelStrategy, painless, solvers);
@@ -94,6 +96,9 @@ buildFromParametersOrTopology(PainlessImpl& painless)
   const Parameters& parameters = painless.parameters();
   if (parameters.topology.empty()) {
     createPermanentWorkersFromParameters(painless);
+  } else if (std::string(parameters.topology) == "auto") {
+    topology::buildPermanentWorkers(topology::generateNumaTopology(parameters),
+                                    painless);
   } else {
     topology::buildPermanentWorkers(
       topology::parseJsonTopology(parameters.topology), painless);
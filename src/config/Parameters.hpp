@@ -35,7 +35,27 @@
         "Timeout in seconds for a solve(). Parsing is not included")           \
   PARAM(verbosity, int, "v", 0, "Verbosity level")                             \
   PARAM(noModel, bool, "no-model", false, "Disable model output")              \
-  PARAM(topology, const char*, "topology", "", "Path to topology .json file")  \
+  PARAM(modelThreads,                                                          \
+        int,                                                                   \
+        "model-threads",                                                       \
+        1,                                                                     \
+        "Threads formatting the model output")                                 \
+  PARAM(binaryModel,                                                           \
+        const char*,                                                           \
+        "binary-model",                                                        \
+        "",                                                                    \
+        "Also write the model in binary to this file")                         \
+  PARAM(topology,                                                              \
+        const char*,                                                           \
+        "topology",                                                            \
+        "",                                                                    \
+        "Path to topology .json file, or auto for a NUMA-aware one")           \
+  PARAM(placement,                                                             \
+        const char*,                                                           \
+        "placement",                                                           \
+        "none",                                                                \
+        "Pinning of the solvers without placement: none, compact (fill a "     \
+        "NUMA node first) or scatter (deal them to the nodes in turn)")        \
   ENDCATEGORY(General)                                                         \
                                                                                \
   CATEGORY(Solving)                                                            \
@@ -62,6 +82,16 @@
         "importDB-cap",                                                        \
         10'000,                                                                \
         "Solver import dabatase capacity")                                     \
+  PARAM(compressFormula,                                                       \
+        bool,                                                                  \
+        "compress-formula",                                                    \
+        false,                                                                 \
+        "Keep the input formula varint encoded (decoded when read)")           \
+  PARAM(verifyModel,                                                           \
+        bool,                                                                  \
+        "verify-model",                                                        \
+        false,                                                                 \
+        "Check models against the formula before reporting SAT")               \
   ENDCATEGORY(Solving)                                                         \
                                                                                \
   CATEGORY(Portfolio)                                                          \
@@ -210,6 +240,73 @@
         600'000,                                                               \
         "Sleep time for sharer after each round of global sharing")            \
   PARAM(oneSharer, bool, "one-sharer", false, "Use only one sharer")           \
+  PARAM(sharingThreads,                                                        \
+        unsigned,                                                              \
+        "sharing-threads",                                                     \
+        0,                                                                     \
+        "Run all the sharing strategies on a pool of this many threads (0: "   \
+        "one thread per sharer)")                                              \
+  PARAM(sharingWakeVolume,                                                     \
+        unsigned,                                                              \
+        "sharing-wake-volume",                                                 \
+        0,                                                                     \
+        "Wake a sharer once this many literals wait to be shared (0: off)")    \
+  PARAM(sharingWakeSize,                                                       \
+        unsigned,                                                              \
+        "sharing-wake-size",                                                   \
+        0,                                                                     \
+        "Wake a sharer on a clause of at most this size (0: off)")             \
+  PARAM(unitChannel,                                                           \
+        bool,                                                                  \
+        "unit-channel",                                                        \
+        false,                                                                 \
+        "Share units through a lock-free lane polled by the CDCL solvers")     \
+  PARAM(exportBatch,                                                           \
+        unsigned,                                                              \
+        "export-batch",                                                        \
+        0,                                                                     \
+        "Learnt clauses staged by a solver before exporting them (0: off)")    \
+  PARAM(exportBatchDelay,                                                      \
+        int,                                                                   \
+        "export-batch-delay",                                                  \
+        10'000,                                                                \
+        "Maximum time (us) a learnt clause stays staged")                      \
+  PARAM(importFilter,                                                          \
+        bool,                                                                  \
+        "import-filter",                                                       \
+        false,                                                                 \
+        "Do not route shared clauses to solvers that eliminated or satisfied " \
+        "one of their literals")                                               \
+  PARAM(sharingRootFilter,                                                     \
+        bool,                                                                  \
+        "sharing-root-filter",                                                 \
+        false,                                                                 \
+        "Drop shared clauses satisfied by known root units and strip their "   \
+        "falsified literals")                                                  \
+  PARAM(sharingReinforce,                                                      \
+        bool,                                                                  \
+        "sharing-reinforce",                                                   \
+        false,                                                                 \
+        "Merge the copies of a clause learnt by several solvers in a round "   \
+        "and share the most learnt clauses first")                             \
+  PARAM(sharingSubsume,                                                        \
+        int,                                                                   \
+        "sharing-subsume",                                                     \
+        0,                                                                     \
+        "Time budget (us) per round to drop the subsumed clauses of a "        \
+        "selection and strengthen the others (0: disabled)")                   \
+  PARAM(importBudget,                                                          \
+        float,                                                                 \
+        "import-budget",                                                       \
+        0.f,                                                                   \
+        "Clauses sent to a solver per round, as a factor of its measured "     \
+        "consumption (0: no budget)")                                          \
+  PARAM(importBacklog,                                                         \
+        unsigned,                                                              \
+        "import-backlog",                                                      \
+        2000,                                                                  \
+        "Clauses waiting in a solver import database above which it gets "     \
+        "no more (with -import-budget)")                                       \
   PARAM(globalSharedLiterals,                                                  \
         int,                                                                   \
         "gshr-lit",                                                            \
@@ -543,6 +640,8 @@ struct Parameters
        "  " BOLD "1" RESET ": HordeSat sharing\n"                              \
        "  " BOLD "2" RESET ": HordeSat sharing with 2 groups of producers\n"   \
        "  " BOLD "3" RESET ": Simple sharing \n"                               \
+       "  " BOLD "4" RESET                                                     \
+       ": HordeSat sharing with clause usefulness feedback\n"                  \
        "\n" BLUE "Global Sharing Strategies " YELLOW "(-gshr-strat)" BLUE      \
        ":\n" RESET "  " BOLD "1" RESET                                         \
        ": AllGatherSharing - Exchange clauses using MPI_Allgather (default)\n" \
@@ -1,5 +1,11 @@
+#include "sharing/LocalStrategies/BridgeSharing.hpp"
+#include "sharing/LocalStrategies/GossipSharing.hpp"
 #include "sharing/LocalStrategies/HordeSatSharing.hpp"
+#include "sharing/LocalStrategies/ImplicationSharing.hpp"
+#include "sharing/LocalStrategies/PhaseSharing.hpp"
 #include "sharing/LocalStrategies/SimpleSharing.hpp"
+#include "sharing/LocalStrategies/TreeSharing.hpp"
+#include "sharing/LocalStrategies/UsefulnessSharing.hpp"
 
 #include "sharing/GlobalStrategies/AllGatherSharing.hpp"
 #include "sharing/GlobalStrategies/GenericGlobalSharing.hpp"
@@ -8,6 +14,8 @@
 #include "config/ClauseDatabaseFactory.hpp"
 #include "config/SharingStrategyFactory.hpp"
 
+#include "sharing/SharingExecutor.hpp"
+
 #include "utils/StringUtils.hpp"
 
 SharingStrategyFactory::SharingStrategyFactory(const Parameters& parameters)
@@ -27,6 +35,18 @@ SharingStrategyFactory::createStrategy(
     strat = std::make_shared<HordeSatSharing>(database);
   else if (name == "simple")
     strat = std::make_shared<SimpleSharing>(database);
+  else if (name == "usefulness")
+    strat = std::make_shared<UsefulnessSharing>(database);
+  else if (name == "bridge")
+    strat = std::make_shared<BridgeSharing>(database);
+  else if (name == "gossip")
+    strat = std::make_shared<GossipSharing>(database);
+  else if (name == "tree")
+    strat = std::make_shared<TreeSharing>(database);
+  else if (name == "phases")
+    strat = std::make_shared<PhaseSharing>();
+  else if (name == "implications")
+    strat = std::make_shared<ImplicationSharing>(database);
   else
     PABORT(PERR_NOT_SUPPORTED, "Sharing Strategy %s is unknown", name.c_str());
 
@@ -147,6 +167,25 @@ SharingStrategyFactory::instantiateLocalStrategies(
       lsharedDB,
       allEntities));
     localStrategies.back()->markConfigured();
+  } else if (strategyNumber == 4) {
+    LOG0("LSTRAT>> UsefulnessSharing (HordeSat with usefulness feedback)");
+    auto strat = std::make_shared<UsefulnessSharing>(
+      allEntities.size(),
+      m_parameters.sharedLiteralsPerProducer,
+      m_parameters.hordeInitialLbdLimit,
+      m_parameters.hordeInitRound,
+      std::chrono::microseconds(m_parameters.sharingSleep),
+      lsharedDB,
+      allEntities);
+    std::stringstream producersList;
+    for (auto entity : allEntities) {
+      entity->addClient(strat);
+      producersList << std::to_string(entity->getSharingId()) << ",";
+    }
+    strat->configure("producer-ids", producersList.str());
+    strat->markConfigured();
+
+    localStrategies.push_back(strat);
   } else {
     LOGERROR("The sharing strategy number chosen isn't correct. Sharing is "
              "disabled !");
@@ -232,7 +271,10 @@ SharingStrategyFactory::createSharers(
   std::vector<std::shared_ptr<SharingStrategy>>& sharingStrategies,
   std::vector<std::shared_ptr<Sharer>>& sharers)
 {
-  if (m_parameters.oneSharer) {
+  if (m_parameters.sharingThreads && !sharingStrategies.empty()) {
+    sharers.emplace_back(new SharingExecutor(
+      manager, 0, sharingStrategies, m_parameters.sharingThreads));
+  } else if (m_parameters.oneSharer) {
     sharers.emplace_back(new Sharer(manager, 0, sharingStrategies));
   } else {
     for (unsigned int i = 0; i < sharingStrategies.size(); i++) {
@@ -31,6 +31,7 @@
  * - 1 - HordeSatSharing with single group
  * - 2 - HordeSatSharing with two groups of producers
  * - 3 - SimpleSharing
+ * - 4 - UsefulnessSharing (not drawn by 0)
  *
  * Global strategy numbers (legacy):
  * - 0 - Default to AllGatherSharing (same as 1)
@@ -48,6 +49,7 @@ struct SharingStrategyFactory
    *        1: HordeSatSharing (1 group)
    *        2: HordeSatSharing (2 groups)
    *        3: SimpleSharing (1 group)
+   *        4: UsefulnessSharing (1 group)
    * @param[out] localStrategies Vector to store the created local strategies.
    * @param sharingEntities Vector of entities to be used in the strategies.
    */
@@ -91,11 +93,12 @@ struct SharingStrategyFactory
    * @brief Create a sharing strategy from a name (topology path).
    * @ingroup topology
    *
-   * Accepted names (case-insensitive): `hordesat`, `simple`. Aborts with
+   * Accepted names (case-insensitive): `hordesat`, `simple`, `usefulness`,
+   * `bridge`, `gossip`, `tree`, `phases`, `implications`. Aborts with
    * PERR_NOT_SUPPORTED on an unknown name.
    *
    * The strategy takes ownership of @p database (one DB per strategy
-   * instance).
+   * instance, unused by `phases`).
    * The returned strategy is *not* yet `markConfigured()`'d: the caller is
    * expected to set parameters and wire producers/clients first.
    */
@@ -1,6 +1,7 @@
 #include "config/SolverFactory.hpp"
 #include "utils/ErrorCodes.hpp"
 #include "utils/Logger.hpp"
+#include "utils/Numa.hpp"
 #include "utils/System.hpp"
 #include "utils/StringUtils.hpp"
 
@@ -250,4 +251,31 @@ SolverFactory::createSolvers(
     if (createdSolver != nullptr)
       solvers.push_back(createdSolver);
   }
-}
\ No newline at end of file
+}
+
+void
+SolverFactory::placeSolvers(
+  const std::string& policy,
+  const std::vector<std::shared_ptr<SolverInterface>>& solvers)
+{
+  const std::string name = pl::str::toLower(policy);
+  if (name.empty() || name == "none")
+    return;
+  PABORTIF(name != "compact" && name != "scatter",
+           PERR_ARGS,
+           "Unknown placement policy %s (none, compact or scatter)",
+           policy.c_str());
+
+  const std::vector<pl::numa::Node> nodes = pl::numa::readNodes();
+  size_t rank = 0;
+  for (const auto& solver : solvers) {
+    if (!solver->getCpuAffinity().empty())
+      continue;
+    solver->setCpuAffinity(
+      pl::numa::placeThread(nodes, name == "scatter", rank++));
+    LOGD1("Solver %d placed on cpu %d",
+          solver->getSolverId(),
+          solver->getCpuAffinity().front());
+  }
+  LOG1("Placed %zu solvers with the %s policy", rank, name.c_str());
+}
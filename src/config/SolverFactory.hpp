@@ -96,6 +96,19 @@ public:
                      FullClauseReader& fullReader,
                      std::vector<std::shared_ptr<SolverInterface>>& solvers);
 
+  /**
+   * @brief Pin the solvers without cpu affinity following an automatic
+   * placement policy (see pl::numa::placeThread).
+   *
+   * @param policy `none` (the solvers float), `compact` or `scatter`. Aborts
+   *        with PERR_ARGS on any other value.
+   * @param solvers Solvers in placement order, the ones already given a cpu
+   *        affinity (e.g. by the topology) are skipped.
+   */
+  static void placeSolvers(
+    const std::string& policy,
+    const std::vector<std::shared_ptr<SolverInterface>>& solvers);
+
 public:
   /**
    * @brief Atomic counter for assigning unique IDs to solvers.
@@ -5,7 +5,9 @@
 #include "config/SharingStrategyFactory.hpp"
 #include "config/SolverFactory.hpp"
 #include "config/WorkingStrategyRegistry.hpp"
+#include "sharing/LocalStrategies/PhaseSharing.hpp"
 #include "sharing/Sharer.hpp"
+#include "sharing/SharingExecutor.hpp"
 #include "utils/ErrorCodes.hpp"
 #include "utils/Logger.hpp"
 #include "utils/StringUtils.hpp"
@@ -39,6 +41,65 @@ setParams(std::shared_ptr<Configurable> configurable,
   }
 }
 
+/// Restart a local searcher from the phases of its guide sources
+static void
+connectGuide(const LocalSearchGuideDesc& guideDesc,
+             const TopologyDesc& topology,
+             const std::vector<std::shared_ptr<SolverCDCLInterface>>& cdcls,
+             const std::shared_ptr<LocalSearchInterface>& localSearcher)
+{
+  PhaseChannel::Source source = PhaseChannel::Source::TARGET;
+  if (guideDesc.mode == "phases")
+    source = PhaseChannel::Source::SAVED;
+  else if (guideDesc.mode == "best")
+    source = PhaseChannel::Source::BEST;
+  auto guide = std::make_shared<LocalSearchGuide>(
+    std::chrono::milliseconds(guideDesc.intervalMs),
+    source,
+    guideDesc.importLearnt);
+
+  for (const std::string& sourceId : guideDesc.sourceIds) {
+    auto cdcl = cdcls[topology.cdclSolverIndex.at(sourceId)];
+    cdcl->addPhaseChannel(guide->getChannel(), true, false);
+    if (guideDesc.importLearnt)
+      cdcl->addClient(guide);
+  }
+  localSearcher->setGuide(guide);
+}
+
+/// Connect the producers and clients of a PhaseSharing strategy to its channel
+static void
+connectPhaseSolvers(
+  const TopologyDesc& topology,
+  const std::vector<std::shared_ptr<SolverCDCLInterface>>& cdcls,
+  const std::vector<std::shared_ptr<LocalSearchInterface>>& localSearchers,
+  const SharingStrategyDesc& stratDesc,
+  const std::shared_ptr<PhaseSharing>& strat)
+{
+  auto findSolver = [&](const std::string& id) {
+    std::shared_ptr<SolverInterface> solver;
+    if (topology.cdclSolverIndex.contains(id))
+      solver = cdcls[topology.cdclSolverIndex.at(id)];
+    else if (topology.localSearcherIndex.contains(id))
+      solver = localSearchers[topology.localSearcherIndex.at(id)];
+    else
+      PABORT(PERR_TOPOLOGY,
+             "Phase sharing %s: %s is not a solver",
+             stratDesc.id.c_str(),
+             id.c_str());
+    return solver;
+  };
+
+  std::unordered_map<std::shared_ptr<SolverInterface>, std::pair<bool, bool>>
+    roles;
+  for (const std::string& producer : stratDesc.producerIds)
+    roles[findSolver(producer)].first = true;
+  for (const std::string& client : stratDesc.clientIds)
+    roles[findSolver(client)].second = true;
+  for (auto& [solver, role] : roles)
+    solver->addPhaseChannel(strat->getChannel(), role.first, role.second);
+}
+
 void
 buildPermanentWorkers(const TopologyDesc& topology, PainlessImpl& painless)
 {
@@ -68,6 +129,7 @@ buildPermanentWorkers(const TopologyDesc& topology, PainlessImpl& painless)
     std::shared_ptr<SolverCDCLInterface> solver =
       SolverFactory::createCDCLSolver(i, cdclDesc.name, solverDB, fullReader);
     setParams(solver, cdclDesc.params);
+    solver->setCpuAffinity(cdclDesc.cpus);
     solver->markConfigured();
 
     cdcls.push_back(solver);
@@ -80,7 +142,10 @@ buildPermanentWorkers(const TopologyDesc& topology, PainlessImpl& painless)
     std::shared_ptr<LocalSearchInterface> solver =
       SolverFactory::createLocalSearcher(i, lsDesc.name, fullReader);
     setParams(solver, lsDesc.params);
+    solver->setCpuAffinity(lsDesc.cpus);
     solver->markConfigured();
+    if (!lsDesc.guide.sourceIds.empty())
+      connectGuide(lsDesc.guide, topology, cdcls, solver);
 
     localSearchers.push_back(solver);
   }
@@ -112,6 +177,15 @@ buildPermanentWorkers(const TopologyDesc& topology, PainlessImpl& painless)
     std::shared_ptr<SharingStrategy> strat =
       sharingStrategies[topology.sharingStrategyIndex.at(shrStratDesc.id)];
 
+    // Phases do not follow the clause subscriptions: the solvers publish to
+    // and poll the channel of the strategy
+    if (auto phases = std::dynamic_pointer_cast<PhaseSharing>(strat)) {
+      connectPhaseSolvers(
+        topology, cdcls, localSearchers, shrStratDesc, phases);
+      strat->markConfigured();
+      continue;
+    }
+
     // Sharing is subscription-based: an entity calls addClient(strat) on each
     // of its producers, and the producer pushes clauses to its subscribers.
 
@@ -140,10 +214,33 @@ buildPermanentWorkers(const TopologyDesc& topology, PainlessImpl& painless)
     // ids of its producers up-front to size its per-producer data structures.
     // The subscription model only flows producer->client at runtime, hence
     // this configure() call is the path used to inject that information.
-    if (pl::str::toLower(shrStratDesc.name) == "hordesat") {
+    const std::string stratName = pl::str::toLower(shrStratDesc.name);
+    if (stratName == "hordesat" || stratName == "usefulness" ||
+        stratName == "gossip" || stratName == "tree") {
       strat->configure("producer-ids", producersList.str());
     }
 
+    // A bridge skips the group a clause comes from: it needs the producers of
+    // the group strategies it links
+    if (stratName == "bridge") {
+      std::stringstream producerGroups;
+      for (const std::string& group : shrStratDesc.producerIds) {
+        if (!topology.sharingStrategyIndex.contains(group))
+          continue;
+        size_t groupIdx = topology.sharingStrategyIndex.at(group);
+        producerGroups << sharingStrategies[groupIdx]->getSharingId() << ":";
+        for (const std::string& producer :
+             topology.sharingStrategies[groupIdx].producerIds) {
+          if (topology.cdclSolverIndex.contains(producer))
+            producerGroups
+              << cdcls[topology.cdclSolverIndex.at(producer)]->getSharingId()
+              << ",";
+        }
+        producerGroups << ";";
+      }
+      strat->configure("producer-groups", producerGroups.str());
+    }
+
     for (const std::string& client : shrStratDesc.clientIds) {
       std::shared_ptr<SharingEntity> clientEntity = nullptr;
       /* Fetch the sharing entity which can either be a solver or a
@@ -189,6 +286,9 @@ buildPermanentWorkers(const TopologyDesc& topology, PainlessImpl& painless)
     solvers.push_back(solverEntity);
   }
 
+  // Solvers without cpu, cpuset or numa field follow the placement policy
+  SolverFactory::placeSolvers(painless.parameters().placement, solvers);
+
   std::shared_ptr<WorkingStrategy> mainStrategy =
     WorkingStrategyRegistry::create(
       topology.workingStrategy.name, painless, solvers);
@@ -199,19 +299,44 @@ buildPermanentWorkers(const TopologyDesc& topology, PainlessImpl& painless)
   painless.setWorkingStrategy(mainStrategy);
 
   /* Finally Sharers */
+  // With sharingThreads, all the strategies of all the sharers go to a single
+  // thread pool
+  const unsigned sharingThreads = painless.parameters().sharingThreads;
+  std::vector<std::shared_ptr<SharingStrategy>> pooledStrategies;
+
+  std::vector<int> pooledCpus;
+
   uint sharerId = 0;
   for (const auto& sharerDesc : topology.sharers) {
     std::vector<std::shared_ptr<SharingStrategy>> strategies;
     for (const auto& stratId : sharerDesc.strategyIds)
       strategies.push_back(
         sharingStrategies[topology.sharingStrategyIndex.at(stratId)]);
+    if (sharingThreads) {
+      pooledStrategies.insert(
+        pooledStrategies.end(), strategies.begin(), strategies.end());
+      pooledCpus.insert(
+        pooledCpus.end(), sharerDesc.cpus.begin(), sharerDesc.cpus.end());
+      continue;
+    }
     // Add it to painless in order to control its startup and termination
     // Need to rethink the painless reference in sharer and workers
-    painless.addSharer(
-      std::make_shared<Sharer>(painless, sharerId, strategies));
+    auto sharer = std::make_shared<Sharer>(painless, sharerId, strategies);
+    if (!sharerDesc.cpus.empty() && !sharer->setCpuAffinity(sharerDesc.cpus))
+      LOGWARN("Could not pin sharer %s", sharerDesc.id.c_str());
+    painless.addSharer(sharer);
     sharerId++;
   }
 
+  if (!pooledStrategies.empty()) {
+    auto executor = std::make_shared<SharingExecutor>(
+      painless, 0, pooledStrategies, sharingThreads);
+    // The pool runs the strategies of every sharer: it gets all their cpus
+    if (!pooledCpus.empty() && !executor->setCpuAffinity(pooledCpus))
+      LOGWARN("Could not pin the sharing executor");
+    painless.addSharer(executor);
+  }
+
   LOG1("Instantiated the main working strategy with the created %zu solvers",
        solvers.size());
 }
@@ -68,6 +68,23 @@ struct CdclSolverDesc
   std::string name;
   std::string importDBId;     ///< Id of a ::DatabaseDesc, resolved by the builder.
   boost::json::object params; ///< Forwarded to the backend solver via setOption.
+  std::vector<int> cpus;      ///< `cpu`/`cpuset`/`numa` (empty: placement policy).
+};
+
+/**
+ * @brief Optional `guide` object of a local searcher (see LocalSearchGuide).
+ *
+ * The local searcher restarts every `interval-ms` from the `mode` phases of
+ * the `sources` CDCL solvers: "trail" (target phases), "phases" (saved
+ * phases) or "best" (best phases). With `import-learnt`, their learnt units
+ * and binaries are enforced on the restart assignment.
+ */
+struct LocalSearchGuideDesc
+{
+  std::vector<std::string> sourceIds; ///< Empty: the searcher is not guided.
+  unsigned intervalMs = 1000;
+  std::string mode = "trail";
+  bool importLearnt = false;
 };
 
 /**
@@ -81,16 +98,20 @@ struct LocalSearchDesc
   std::string id;
   std::string name;
   boost::json::object params;
+  std::vector<int> cpus; ///< `cpu`/`cpuset`/`numa` (empty: placement policy).
+  LocalSearchGuideDesc guide;
 };
 
 /**
  * @brief A sharing strategy instance (entry of `sharingStrategies`).
  *
- * `name` selects the strategy implementation ("hordesat", "simple"). The
+ * `name` selects the strategy implementation ("hordesat", "simple",
+ * "usefulness", "bridge", "gossip", "tree", "phases", "implications"). The
  * strategy owns a fresh ClauseDatabase built from `dbId`. Producer and client
  * ids may point at CDCL solvers *or* at other sharing strategies, allowing
  * hierarchical sharing topologies (e.g. local strategies feeding a global
- * one). Each sharing-strategy id may appear at most once across all
+ * one). The ids of a "phases" strategy point at CDCL solvers or local
+ * searchers. Each sharing-strategy id may appear at most once across all
  * `producers`/`clients` lists in the file.
  */
 struct SharingStrategyDesc
@@ -114,6 +135,7 @@ struct SharerDesc
 {
   std::string id;
   std::vector<std::string> strategyIds; ///< Ids of ::SharingStrategyDesc to drive.
+  std::vector<int> cpus;                ///< `cpu`/`cpuset`/`numa` (empty: floating).
 };
 
 /**
@@ -188,6 +210,24 @@ struct TopologyDesc
 TopologyDesc
 parseJsonTopology(const std::string& jsonPath);
 
+/**
+ * @brief Generate the `auto` topology from the machine layout (see
+ * pl::numa::readNodes).
+ *
+ * The `cpus` solvers of the `solver` portfolio are spread over the NUMA nodes
+ * in proportion to their cpus. Each node gets a `hordesat` strategy over its
+ * solvers, driven by its own sharer; with several nodes a `bridge` strategy,
+ * on a sharer of its own, forwards the best clauses between the node
+ * strategies. Solvers and node sharers are pinned to the cpus of their node.
+ * The strategies take their settings from @p parameters (shr-lit-per-prod,
+ * horde-initial-lbd, horde-init-round, shr-sleep).
+ *
+ * The result bypasses the reference checks of ::parseJsonTopology: a node
+ * strategy is referenced by its sharer and by the bridge.
+ */
+TopologyDesc
+generateNumaTopology(const Parameters& parameters);
+
 /**
  * @brief Instantiate every entity declared by @p topology and wire them into
  * @p painless (solvers, sharing strategies, sharers, working strategy).
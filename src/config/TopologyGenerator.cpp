@@ -0,0 +1,178 @@
+#include "config/TopologyConfigurator.hpp"
+#include "utils/ErrorCodes.hpp"
+#include "utils/Logger.hpp"
+#include "utils/Numa.hpp"
+
+#include <string>
+
+namespace topology {
+
+/// Topology name of a CDCL portfolio letter, empty for any other letter
+static std::string
+cdclSolverName(char type)
+{
+  switch (type) {
+    case 'k':
+      return "kissat";
+    case 'c':
+      return "cadical";
+    case 'l':
+      return "lingeling";
+    case 'm':
+      return "minisat";
+    case 'g':
+      return "glucosesyrup";
+    case 'M':
+      return "maplecomsps";
+    default:
+      return "";
+  }
+}
+
+/// Topology name of a local search portfolio letter, empty otherwise
+static std::string
+localSearcherName(char type)
+{
+  switch (type) {
+    case 'y':
+      return "yalsat";
+    case 't':
+      return "tassat";
+    default:
+      return "";
+  }
+}
+
+TopologyDesc
+generateNumaTopology(const Parameters& parameters)
+{
+  const std::vector<pl::numa::Node> nodes = pl::numa::readNodes();
+  const std::string portfolio = parameters.solver;
+  PABORTIF(portfolio.empty(), PERR_ARGS, "Empty solver portfolio");
+
+  TopologyDesc topology;
+
+  auto refer = [&topology](const std::string& id) { topology.idRefs[id]++; };
+
+  /* One import and one sharing template, cloned per consumer */
+  DatabaseDesc importDB{ "auto_import", "persize", 0, {} };
+  importDB.params["max-clause-size"] = parameters.maxClauseSize;
+  DatabaseDesc sharingDB{ "auto_sharing", "persize", 0, {} };
+  sharingDB.params["max-clause-size"] = parameters.maxClauseSize;
+  for (const DatabaseDesc& database : { importDB, sharingDB }) {
+    topology.idRefs.emplace(database.id, 0);
+    topology.databaseTemplateIndex.emplace(database.id,
+                                           topology.databaseTemplates.size());
+    topology.databaseTemplates.push_back(database);
+  }
+
+  size_t totalCpus = 0;
+  for (const pl::numa::Node& node : nodes)
+    totalCpus += node.cpus.size();
+
+  const bool bridged = nodes.size() > 1;
+  const int solverCount = parameters.cpus;
+
+  /* Solvers are spread in contiguous blocks proportional to the node cpus */
+  size_t cpusBefore = 0;
+  for (const pl::numa::Node& node : nodes) {
+    const int first = solverCount * cpusBefore / totalCpus;
+    cpusBefore += node.cpus.size();
+    const int last = solverCount * cpusBefore / totalCpus;
+
+    const std::string nodeId = "node" + std::to_string(node.id);
+    SharingStrategyDesc nodeStrategy;
+    nodeStrategy.id = "horde_" + nodeId;
+    nodeStrategy.name = "hordesat";
+    nodeStrategy.dbId = sharingDB.id;
+    nodeStrategy.params["literals-per-producer-per-round"] =
+      parameters.sharedLiteralsPerProducer;
+    nodeStrategy.params["initial-lbd-limit"] =
+      static_cast<int>(parameters.hordeInitialLbdLimit);
+    nodeStrategy.params["rounds-before-increase"] =
+      static_cast<int>(parameters.hordeInitRound);
+    nodeStrategy.params["sleep-time-us"] = parameters.sharingSleep;
+
+    for (int i = first; i < last; i++) {
+      const char type = portfolio.at(i % portfolio.size());
+      const std::string solverId = nodeId + "_" + std::to_string(i);
+
+      if (std::string name = cdclSolverName(type); !name.empty()) {
+        CdclSolverDesc cdclDesc{ solverId, name, importDB.id, {}, node.cpus };
+        refer(importDB.id);
+        topology.cdclSolverIndex.emplace(solverId,
+                                         topology.cdclSolvers.size());
+        topology.cdclSolvers.push_back(std::move(cdclDesc));
+
+        nodeStrategy.producerIds.push_back(solverId);
+        nodeStrategy.clientIds.push_back(solverId);
+        refer(solverId);
+      } else if (std::string name = localSearcherName(type); !name.empty()) {
+        LocalSearchDesc lsDesc{ solverId, name, {}, node.cpus };
+        topology.localSearcherIndex.emplace(solverId,
+                                            topology.localSearchers.size());
+        topology.localSearchers.push_back(std::move(lsDesc));
+      } else {
+        PABORT(PERR_UNKNOWN_SOLVER,
+               "The solver type %c is not available in the auto topology",
+               type);
+      }
+
+      topology.workingStrategy.solverIds.push_back(solverId);
+      refer(solverId);
+    }
+
+    /* A node without CDCL solver has nothing to share */
+    if (nodeStrategy.producerIds.empty())
+      continue;
+
+    refer(sharingDB.id);
+    topology.sharingStrategyIndex.emplace(nodeStrategy.id,
+                                          topology.sharingStrategies.size());
+    topology.sharers.push_back(
+      SharerDesc{ "sharer_" + nodeId, { nodeStrategy.id }, node.cpus });
+    topology.sharerIndex.emplace(topology.sharers.back().id,
+                                 topology.sharers.size() - 1);
+    refer(nodeStrategy.id);
+    topology.sharingStrategies.push_back(std::move(nodeStrategy));
+  }
+
+  /* The bridge links the node strategies, it floats as it serves them all */
+  if (bridged && topology.sharingStrategies.size() > 1) {
+    SharingStrategyDesc bridge;
+    bridge.id = "bridge";
+    bridge.name = "bridge";
+    bridge.dbId = sharingDB.id;
+    bridge.params["literals-per-round"] =
+      parameters.sharedLiteralsPerProducer;
+    bridge.params["sleep-time-us"] = parameters.sharingSleep;
+    // Each link is declared once, as a producer: the builder subscribes the
+    // strategy to its producers, a client entry would subscribe it again
+    for (SharingStrategyDesc& nodeStrategy : topology.sharingStrategies) {
+      nodeStrategy.producerIds.push_back(bridge.id);
+      bridge.producerIds.push_back(nodeStrategy.id);
+      refer(nodeStrategy.id);
+      refer(bridge.id);
+    }
+
+    refer(sharingDB.id);
+    topology.sharingStrategyIndex.emplace(bridge.id,
+                                          topology.sharingStrategies.size());
+    topology.sharers.push_back(
+      SharerDesc{ "sharer_bridge", { bridge.id }, {} });
+    topology.sharerIndex.emplace("sharer_bridge", topology.sharers.size() - 1);
+    refer(bridge.id);
+    topology.sharingStrategies.push_back(std::move(bridge));
+  }
+
+  topology.workingStrategy.name = parameters.parallelStrategy;
+
+  LOG0("Generated the auto topology over %zu NUMA node(s), %zu cpus",
+       nodes.size(),
+       totalCpus);
+  logTopologySummary(topology);
+
+  return topology;
+}
+
+} // namespace topology
@@ -1,6 +1,7 @@
 #include "config/TopologyConfigurator.hpp"
 #include "utils/ErrorCodes.hpp"
 #include "utils/Logger.hpp"
+#include "utils/Numa.hpp"
 
 #include <boost/json.hpp>
 #include <fstream>
@@ -28,6 +29,73 @@ jsonIdArrayToVector(std::unordered_map<std::string, uint>& idRefs,
   return vector;
 }
 
+/* Optional placement of a solver or sharer thread, at most one of: `cpu` (a
+ * cpu number), `cpuset` (a cpu list "0-3,8") or `numa` (a node id, for all
+ * its cpus). Empty if none is given */
+static std::vector<int>
+parsePlacement(const boost::json::object& object, const std::string& id)
+{
+  const int fields = object.contains("cpu") + object.contains("cpuset") +
+                     object.contains("numa");
+  PABORTIF(fields > 1,
+           PERR_TOPOLOGY,
+           "Entity %s has more than one of cpu, cpuset and numa",
+           id.c_str());
+
+  std::vector<int> cpus;
+  if (object.contains("cpu")) {
+    cpus.push_back(static_cast<int>(object.at("cpu").as_int64()));
+    PABORTIF(
+      cpus.front() < 0, PERR_TOPOLOGY, "Negative cpu for %s", id.c_str());
+  } else if (object.contains("cpuset")) {
+    cpus = pl::numa::parseCpuList(
+      boost::json::value_to<std::string>(object.at("cpuset")));
+    PABORTIF(cpus.empty(),
+             PERR_TOPOLOGY,
+             "Malformed cpuset for %s",
+             id.c_str());
+  } else if (object.contains("numa")) {
+    static const std::vector<pl::numa::Node> nodes = pl::numa::readNodes();
+    const int64_t nodeId = object.at("numa").as_int64();
+    for (const pl::numa::Node& node : nodes)
+      if (node.id == nodeId)
+        cpus = node.cpus;
+    PABORTIF(cpus.empty(),
+             PERR_TOPOLOGY,
+             "NUMA node %ld of %s has no cpu available",
+             nodeId,
+             id.c_str());
+  }
+  return cpus;
+}
+
+/* Optional guide of a local searcher, its sources are checked once the CDCL
+ * solvers are parsed */
+static LocalSearchGuideDesc
+parseGuide(const boost::json::object& object, const std::string& id)
+{
+  LocalSearchGuideDesc guide;
+  for (auto& source : object.at("sources").as_array())
+    guide.sourceIds.push_back(boost::json::value_to<std::string>(source));
+  PABORTIF(guide.sourceIds.empty(),
+           PERR_TOPOLOGY,
+           "The guide of %s has no source",
+           id.c_str());
+  if (object.contains("interval-ms"))
+    guide.intervalMs = object.at("interval-ms").as_int64();
+  if (object.contains("mode"))
+    guide.mode = boost::json::value_to<std::string>(object.at("mode"));
+  PABORTIF(guide.mode != "trail" && guide.mode != "phases" &&
+             guide.mode != "best",
+           PERR_TOPOLOGY,
+           "Unknown guide mode %s for %s",
+           guide.mode.c_str(),
+           id.c_str());
+  if (object.contains("import-learnt"))
+    guide.importLearnt = object.at("import-learnt").as_bool();
+  return guide;
+}
+
 TopologyDesc
 parseJsonTopology(const std::string& jsonPath)
 {
@@ -104,6 +172,9 @@ parseJsonTopology(const std::string& jsonPath)
       lsDesc.name = lsObject.at("type").as_string();
       if (lsObject.contains("params"))
         lsDesc.params = lsObject.at("params").as_object();
+      lsDesc.cpus = parsePlacement(lsObject, lsDesc.id);
+      if (lsObject.contains("guide"))
+        lsDesc.guide = parseGuide(lsObject.at("guide").as_object(), lsDesc.id);
 
       PABORTIF(topology.idRefs.contains(lsDesc.id),
                PERR_TOPOLOGY,
@@ -135,6 +206,7 @@ parseJsonTopology(const std::string& jsonPath)
       cdclDesc.importDBId = cdclObject.at("importDB").as_string();
       if (cdclObject.contains("params"))
         cdclDesc.params = cdclObject.at("params").as_object();
+      cdclDesc.cpus = parsePlacement(cdclObject, cdclDesc.id);
 
       PABORTIF(topology.idRefs.contains(cdclDesc.id),
                PERR_TOPOLOGY,
@@ -240,6 +312,7 @@ parseJsonTopology(const std::string& jsonPath)
 
       SharerDesc sharerDesc;
       sharerDesc.id = sharerObject.at("id").as_string();
+      sharerDesc.cpus = parsePlacement(sharerObject, sharerDesc.id);
 
       sharerDesc.strategyIds =
         jsonIdArrayToVector(topology.idRefs,
@@ -258,6 +331,14 @@ parseJsonTopology(const std::string& jsonPath)
            e.what());
   }
 
+  for (const auto& lsDesc : topology.localSearchers)
+    for (const std::string& source : lsDesc.guide.sourceIds)
+      PABORTIF(!topology.cdclSolverIndex.contains(source),
+               PERR_TOPOLOGY,
+               "The guide source %s of %s is not a CDCL solver",
+               source.c_str(),
+               lsDesc.id.c_str());
+
   for (auto& idRef : topology.idRefs) {
     PABORTIF(idRef.second == 0,
              PERR_TOPOLOGY,
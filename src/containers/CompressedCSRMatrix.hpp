@@ -0,0 +1,333 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace pl {
+
+// Varint helpers
+// ==============
+
+namespace varint {
+
+// LEB128 style: 7 bits of payload per byte, high bit set when more bytes follow
+inline void
+encode(std::vector<uint8_t>& out, uint64_t value)
+{
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+inline uint64_t
+decode(uint8_t const*& ptr)
+{
+  uint64_t value = *ptr & 0x7f;
+  uint shift = 7;
+  while (*ptr++ & 0x80) {
+    value |= static_cast<uint64_t>(*ptr & 0x7f) << shift;
+    shift += 7;
+  }
+  return value;
+}
+
+}
+
+// Compressed row
+// ==============
+
+// Literals are mapped to their unsigned code (2 * var + sign), sorted, then
+// stored as [size][first code][delta][delta]... all varint encoded. Sorting by
+// code keeps the deltas small (the two polarities of a variable are adjacent),
+// most clauses end up with one byte per literal.
+template<typename T = int>
+class compressed_row_iterator
+{
+  static_assert(std::is_integral<T>::value && std::is_signed<T>::value,
+                "T must be a signed integer type");
+
+public:
+  using iterator_category = std::input_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = T;
+  using pointer = void;
+  using reference = T;
+
+  compressed_row_iterator()
+    : m_ptr(nullptr)
+    , m_remaining(0)
+    , m_code(0)
+  {
+  }
+  compressed_row_iterator(uint8_t const* ptr, std::size_t remaining)
+    : m_ptr(ptr)
+    , m_remaining(remaining)
+    , m_code(0)
+  {
+    if (m_remaining)
+      m_code = varint::decode(m_ptr);
+  }
+
+  value_type operator*() const
+  {
+    value_type var = static_cast<value_type>(m_code >> 1);
+    return (m_code & 1) ? -var : var;
+  }
+
+  compressed_row_iterator<T>& operator++()
+  {
+    if (--m_remaining)
+      m_code += varint::decode(m_ptr);
+    return *this;
+  }
+
+  compressed_row_iterator<T> operator++(int)
+  {
+    compressed_row_iterator ret = *this;
+    ++(*this);
+    return ret;
+  }
+
+  // Only the remaining count matters: any two exhausted iterators are equal
+  bool operator==(const compressed_row_iterator<T>& other) const
+  {
+    return m_remaining == other.m_remaining;
+  }
+  bool operator!=(const compressed_row_iterator<T>& other) const
+  {
+    return !(this->operator==(other));
+  }
+
+private:
+  uint8_t const* m_ptr;
+  std::size_t m_remaining;
+  uint64_t m_code;
+};
+
+// Read only view over an encoded row, decoding happens on iteration
+template<typename T = int>
+class compressed_row_view
+{
+public:
+  using size_type = std::size_t;
+  using value_type = T;
+  using const_iterator = compressed_row_iterator<T>;
+
+  compressed_row_view()
+    : m_data(nullptr)
+    , m_size(0)
+  {
+  }
+  explicit compressed_row_view(uint8_t const* ptr)
+    : m_data(ptr)
+  {
+    m_size = static_cast<size_type>(varint::decode(m_data));
+  }
+
+  size_type size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  const_iterator begin() const { return const_iterator(m_data, m_size); }
+  const_iterator end() const { return const_iterator(); }
+
+  /// Decodes the row in scratch (reused between calls) and returns a span on it
+  std::span<const value_type> decode(std::vector<value_type>& scratch) const
+  {
+    scratch.assign(begin(), end());
+    return std::span<const value_type>(scratch.data(), scratch.size());
+  }
+
+private:
+  uint8_t const* m_data;
+  size_type m_size;
+};
+
+// Compressed Formula
+// ==================
+// Same row interface as csr_matrix_t, but rows are varint encoded (see
+// compressed_row_iterator) and the row index uses 32-bit offsets relative to a
+// 64-bit base stored every ROWS_PER_BLOCK rows.
+// Rows are read back with their literals sorted by code, the original order is
+// not preserved.
+template<typename T = int>
+class compressed_csr_matrix_t
+{
+  static_assert(std::is_integral<T>::value && std::is_signed<T>::value,
+                "T must be a signed integer type");
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using row_type = compressed_row_view<T>;
+
+  static constexpr size_type ROWS_PER_BLOCK = 64;
+
+  compressed_csr_matrix_t()
+    : m_literal_count(0)
+  {
+  }
+
+  // Size information
+  size_type row_count() const { return m_row_to_offset.size(); }
+  size_type net_size() const { return m_literal_count; }
+  bool empty() const { return row_count() == 0; }
+
+  /// Bytes used by the encoded rows and their index
+  size_type memory_footprint() const
+  {
+    return m_data.capacity() * sizeof(uint8_t) +
+           m_row_to_offset.capacity() * sizeof(uint32_t) +
+           m_block_to_offset.capacity() * sizeof(uint64_t);
+  }
+
+  /// Bytes a csr_matrix_t<T> would need for the same rows
+  size_type plain_footprint() const
+  {
+    return (net_size() + row_count()) * sizeof(T) +
+           row_count() * sizeof(size_type);
+  }
+
+  // Setters
+
+  template<typename InputIt>
+  void push_row(InputIt begin, InputIt end)
+  {
+    m_codes.clear();
+    for (auto it = begin; it != end; ++it) {
+      T lit = *it;
+      uint64_t var = static_cast<uint64_t>(lit < 0 ? -static_cast<int64_t>(lit)
+                                                   : static_cast<int64_t>(lit));
+      m_codes.push_back((var << 1) | (lit < 0));
+    }
+    std::sort(m_codes.begin(), m_codes.end());
+
+    if (row_count() % ROWS_PER_BLOCK == 0)
+      m_block_to_offset.push_back(m_data.size());
+
+    uint64_t relative = m_data.size() - m_block_to_offset.back();
+    assert(relative <= UINT32_MAX);
+    m_row_to_offset.push_back(static_cast<uint32_t>(relative));
+
+    varint::encode(m_data, m_codes.size());
+    uint64_t previous = 0;
+    for (uint64_t code : m_codes) {
+      varint::encode(m_data, code - previous);
+      previous = code;
+    }
+    m_literal_count += m_codes.size();
+  }
+
+  void push_row(std::initializer_list<T> literals)
+  {
+    push_row(literals.begin(), literals.end());
+  }
+
+  void push(T element)
+  {
+    if (element == 0) {
+      push_row(m_temp_row.begin(), m_temp_row.end());
+      m_temp_row.clear();
+    } else {
+      m_temp_row.push_back(element);
+    }
+  }
+
+  // Getters
+
+  row_type get_nth_row(size_type row_index) const
+  {
+    assert(row_index < row_count());
+    return row_type(m_data.data() +
+                    m_block_to_offset[row_index / ROWS_PER_BLOCK] +
+                    m_row_to_offset[row_index]);
+  }
+
+  row_type operator[](size_type row_index) const
+  {
+    return get_nth_row(row_index);
+  }
+
+  row_type row_at(size_type row_index) const
+  {
+    if (row_index >= row_count()) {
+      throw std::out_of_range("compressed_csr_matrix_t::row_at");
+    }
+    return get_nth_row(row_index);
+  }
+
+  row_type back() const
+  {
+    assert(!empty());
+    return get_nth_row(row_count() - 1);
+  }
+
+  /// Decodes a row into scratch, the span is valid until scratch is modified
+  std::span<const value_type> span_at(size_type row_index,
+                                      std::vector<value_type>& scratch) const
+  {
+    return row_at(row_index).decode(scratch);
+  }
+
+  /**
+   * Decodes rows [first, last) back to back in literals, row_ends receives the
+   * end offset of each row. Meant to amortize the decoding over a batch before
+   * handing out plain spans.
+   */
+  void decode_rows(size_type first,
+                   size_type last,
+                   std::vector<value_type>& literals,
+                   std::vector<size_type>& row_ends) const
+  {
+    assert(first <= last && last <= row_count());
+    literals.clear();
+    row_ends.clear();
+    for (size_type i = first; i < last; i++) {
+      row_type row = get_nth_row(i);
+      literals.insert(literals.end(), row.begin(), row.end());
+      row_ends.push_back(literals.size());
+    }
+  }
+
+  // Helpers
+
+  void clear()
+  {
+    m_data.clear();
+    m_row_to_offset.clear();
+    m_block_to_offset.clear();
+    m_literal_count = 0;
+  }
+
+  // elementCount is a literal count, one byte per literal is the common case
+  void reserve(ulong elementCount, ulong rowCount = 0)
+  {
+    m_data.reserve(elementCount + rowCount);
+    m_row_to_offset.reserve(rowCount);
+    m_block_to_offset.reserve(rowCount / ROWS_PER_BLOCK + 1);
+  }
+
+  void shrink_to_fit()
+  {
+    m_data.shrink_to_fit();
+    m_row_to_offset.shrink_to_fit();
+    m_block_to_offset.shrink_to_fit();
+  }
+
+private:
+  std::vector<uint8_t> m_data;
+  std::vector<uint32_t> m_row_to_offset;
+  std::vector<uint64_t> m_block_to_offset;
+  size_type m_literal_count;
+
+  std::vector<uint64_t> m_codes;
+  std::vector<T> m_temp_row;
+};
+
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace pl {
+/**
+ * @brief Literal to clause occurrence lists of a formula, stored in CSR form.
+ *
+ * The lists of literal l are the clause indices [m_offsets[k], m_offsets[k+1])
+ * of m_clauses with k = 2 * var(l) + (l < 0). Each list is sorted by clause
+ * index.
+ *
+ * The build is done in two passes over disjoint row ranges, one per thread:
+ * a counting pass, then a prefix sum over (literal, thread) giving every
+ * thread its own write cursor per literal, then a filling pass without any
+ * synchronization.
+ */
+class OccurrenceIndex
+{
+public:
+  /// Minimum number of rows handled by a thread during the build
+  static constexpr size_t MIN_ROWS_PER_THREAD = 100'000;
+
+  OccurrenceIndex() = default;
+
+  /**
+   * @brief Build the index of a formula.
+   * @tparam Formula csr_matrix_t or compressed_csr_matrix_t (anything with
+   * row_count() and a const operator[] returning an iterable row)
+   * @param formula the formula to index, it must not be modified during the
+   * build
+   * @param threadCount maximum number of threads to use (0 = hardware
+   * concurrency)
+   */
+  template<typename Formula>
+  void build(const Formula& formula, unsigned threadCount = 0)
+  {
+    const size_t rowCount = formula.row_count();
+
+    if (threadCount == 0)
+      threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = static_cast<unsigned>(std::clamp<size_t>(
+      rowCount / MIN_ROWS_PER_THREAD, 1, threadCount));
+
+    auto rangeBegin = [&](unsigned t) { return rowCount * t / threadCount; };
+
+    // Counting pass: per thread counters, sized on demand
+    std::vector<std::vector<size_t>> counts(threadCount);
+    std::vector<size_t> maxIndex(threadCount, 0);
+    runOnRanges(threadCount, [&](unsigned t) {
+      std::vector<size_t>& local = counts[t];
+      size_t localMax = 0;
+      for (size_t row = rangeBegin(t); row < rangeBegin(t + 1); row++) {
+        for (auto lit : formula[row]) {
+          size_t idx = litIndex(lit);
+          if (idx >= local.size())
+            local.resize(std::max(idx + 1, 2 * local.size()), 0);
+          local[idx]++;
+          localMax = std::max(localMax, idx);
+        }
+      }
+      maxIndex[t] = localMax;
+    });
+
+    // Both polarities of the highest variable
+    size_t litCount =
+      (*std::max_element(maxIndex.begin(), maxIndex.end()) | 1) + 1;
+    for (auto& local : counts)
+      local.resize(litCount, 0);
+
+    // Prefix sum: counts[t][k] becomes the write cursor of thread t for k
+    m_offsets.assign(litCount + 1, 0);
+    size_t total = 0;
+    for (size_t k = 0; k < litCount; k++) {
+      m_offsets[k] = total;
+      for (unsigned t = 0; t < threadCount; t++) {
+        size_t count = counts[t][k];
+        counts[t][k] = total;
+        total += count;
+      }
+    }
+    m_offsets[litCount] = total;
+
+    // Filling pass
+    m_clauses.resize(total);
+    runOnRanges(threadCount, [&](unsigned t) {
+      std::vector<size_t>& cursors = counts[t];
+      for (size_t row = rangeBegin(t); row < rangeBegin(t + 1); row++) {
+        for (auto lit : formula[row]) {
+          m_clauses[cursors[litIndex(lit)]++] = static_cast<uint32_t>(row);
+        }
+      }
+    });
+
+    m_rowCount = rowCount;
+  }
+
+  /**
+   * @brief Get the clauses containing a literal.
+   * @param lit the literal (a variable out of the index has no occurrence)
+   * @return span of clause indices, in increasing order
+   */
+  std::span<const uint32_t> occurrences(int lit) const
+  {
+    size_t idx = litIndex(lit);
+    if (idx + 1 >= m_offsets.size())
+      return {};
+    return std::span<const uint32_t>(m_clauses.data() + m_offsets[idx],
+                                     m_offsets[idx + 1] - m_offsets[idx]);
+  }
+
+  size_t occurrenceCount(int lit) const { return occurrences(lit).size(); }
+
+  /// Highest variable seen in the formula
+  unsigned variableCount() const
+  {
+    return m_offsets.empty() ? 0 : (m_offsets.size() - 1) / 2 - 1;
+  }
+
+  /// Number of formula rows indexed, used to detect a stale index
+  size_t rowCount() const { return m_rowCount; }
+
+  size_t memoryFootprint() const
+  {
+    return m_offsets.capacity() * sizeof(size_t) +
+           m_clauses.capacity() * sizeof(uint32_t);
+  }
+
+private:
+  static size_t litIndex(int lit)
+  {
+    return lit < 0 ? 2 * static_cast<size_t>(-static_cast<int64_t>(lit)) + 1
+                   : 2 * static_cast<size_t>(lit);
+  }
+
+  template<typename Work>
+  static void runOnRanges(unsigned threadCount, Work&& work)
+  {
+    if (threadCount == 1) {
+      work(0);
+      return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (unsigned t = 0; t < threadCount; t++)
+      threads.emplace_back(work, t);
+    for (auto& thread : threads)
+      thread.join();
+  }
+
+  std::vector<size_t> m_offsets;
+  std::vector<uint32_t> m_clauses;
+  size_t m_rowCount = 0;
+};
+}
@@ -5,6 +5,8 @@
 
 #include "utils/Parsers.hpp"
 
+#include "containers/Bitset.hpp"
+
 #include "utils/Logger.hpp"
 
 #include <random>
@@ -65,6 +67,41 @@ PainlessImpl::~PainlessImpl()
   if (m_watchdogThread.joinable())
     m_watchdogThread.join();
 
+  // Release the references between solvers and strategies (see
+  // SharingEntity), once the workers running the solvers are joined
+  m_mainStrategy.reset();
+  for (auto& solver : m_solvers) {
+    if (auto entity = std::dynamic_pointer_cast<SharingEntity>(solver))
+      entity->clearClients();
+  }
+
+  if (m_useCompressedFormula) {
+    std::size_t compressed = m_compressedFormula.memory_footprint();
+    std::size_t plain = m_compressedFormula.plain_footprint();
+    LOGSTAT("Compressed formula: %zu clauses, %zu literals, %zu bytes instead "
+            "of %zu (saved %.2lf%%). Decoded %llu literals in %lf s",
+            m_compressedFormula.row_count(),
+            m_compressedFormula.net_size(),
+            compressed,
+            plain,
+            plain ? 100.0 * (1.0 - static_cast<double>(compressed) / plain) : 0,
+            m_formulaDecodedLiterals.load(),
+            static_cast<double>(m_formulaDecodeTime) / MILLION);
+  }
+
+  if (m_unitChannel) {
+    LOGSTAT("Unit channel: %zu units published%s",
+            m_unitChannel->size(),
+            m_unitChannel->hasConflict() ? ", opposite units found" : "");
+  }
+
+  if (m_verifiedModels) {
+    LOGSTAT("Model verification: %u models (%u rejected) in %lf s",
+            m_verifiedModels.load(),
+            m_rejectedModels.load(),
+            static_cast<double>(m_verificationTime) / MILLION);
+  }
+
   for (auto& pair : m_modelSeenCount) {
     LOGWARN("I have seen the model %llu, %u times (including this one)",
             pair.first,
@@ -104,7 +141,10 @@ PainlessImpl::addLiteral(lit_t lit)
     // }
     // Producer side, requires a unique lock
     UNIQUE_LOCK(std::shared_mutex, m_formulaMX, lock);
-    m_formula.push_row(m_bufferedCls.begin(), m_bufferedCls.end());
+    if (m_useCompressedFormula)
+      m_compressedFormula.push_row(m_bufferedCls.begin(), m_bufferedCls.end());
+    else
+      m_formula.push_row(m_bufferedCls.begin(), m_bufferedCls.end());
     m_bufferedCls.clear();
   }
 
@@ -340,6 +380,120 @@ PainlessImpl::waitOnResultFor(uint64_t microseconds)
   return !m_resultQueue.empty();
 }
 
+/// Check rows [0, formula.row_count()) in parallel ranges, the first
+/// falsified clause stops all the threads
+template<typename Formula>
+static bool
+isSatisfiedBy(const Formula& formula,
+              const pl::Bitset& values,
+              std::size_t varCount,
+              unsigned threadCount)
+{
+  std::atomic<bool> falsified = false;
+  const std::size_t rowCount = formula.row_count();
+
+  auto check = [&](unsigned t) {
+    std::size_t end = rowCount * (t + 1) / threadCount;
+    for (std::size_t row = rowCount * t / threadCount; row < end; row++) {
+      if (row % 1024 == 0 && falsified.load(std::memory_order_relaxed))
+        return;
+      bool satisfied = false;
+      for (lit_t lit : formula[row]) {
+        std::size_t var = std::abs(lit);
+        if (var <= varCount && values[var] == (lit > 0)) {
+          satisfied = true;
+          break;
+        }
+      }
+      if (!satisfied) {
+        LOGD1("Clause %zu is falsified by the model", row);
+        falsified = true;
+        return;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned t = 1; t < threadCount; t++)
+    threads.emplace_back(check, t);
+  check(0);
+  for (auto& thread : threads)
+    thread.join();
+
+  return !falsified;
+}
+
+bool
+PainlessImpl::verifyModel(model_view_t model)
+{
+  if (!m_parameters.verifyModel)
+    return true;
+
+  auto start = std::chrono::steady_clock::now();
+
+  // model[i] is the literal of variable i + 1
+  pl::Bitset values(model.size() + 1);
+  for (std::size_t i = 0; i < model.size(); i++)
+    values.set(i + 1, model[i] > 0);
+
+  bool valid;
+  {
+    SHARED_LOCK(std::shared_mutex, m_formulaMX, lock);
+    unsigned threadCount = std::clamp<std::size_t>(
+      clauseCount() / MIN_ROWS_PER_VERIFIER,
+      1,
+      std::max(1u, std::thread::hardware_concurrency()));
+    valid =
+      m_useCompressedFormula
+        ? isSatisfiedBy(m_compressedFormula, values, model.size(), threadCount)
+        : isSatisfiedBy(m_formula, values, model.size(), threadCount);
+  }
+
+  uint64_t elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  m_verificationTime += elapsed;
+  m_verifiedModels++;
+
+  if (!valid) {
+    m_rejectedModels++;
+    LOGERROR("A model was rejected by the verification, waiting for another "
+             "result");
+  } else {
+    LOG0("Model verified in %lf s", static_cast<double>(elapsed) / MILLION);
+  }
+  return valid;
+}
+
+std::shared_ptr<const pl::OccurrenceIndex>
+PainlessImpl::getOccurrenceIndex()
+{
+  LOCK_GUARD(std::mutex, m_occurrenceIndexMX, l);
+  SHARED_LOCK(std::shared_mutex, m_formulaMX, lock);
+
+  if (m_occurrenceIndex && m_occurrenceIndex->rowCount() == clauseCount())
+    return m_occurrenceIndex;
+
+  auto start = std::chrono::steady_clock::now();
+  auto index = std::make_shared<pl::OccurrenceIndex>();
+  if (m_useCompressedFormula)
+    index->build(m_compressedFormula);
+  else
+    index->build(m_formula);
+
+  LOGSTAT("Occurrence index of %zu clauses and %u variables built in %lf s "
+          "(%zu bytes)",
+          index->rowCount(),
+          index->variableCount(),
+          std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                        start)
+            .count(),
+          index->memoryFootprint());
+
+  m_occurrenceIndex = index;
+  return m_occurrenceIndex;
+}
+
 bool
 PainlessImpl::pushResult(SatAnswer answer, model_t&& model)
 {
@@ -426,6 +580,70 @@ PainlessImpl::popLastResult(result_t& result)
   return true;
 }
 
+void
+PainlessImpl::configureSolverSharing()
+{
+  if (m_parameters.unitChannel)
+    m_unitChannel = std::make_shared<UnitChannel>();
+
+  // The solvers report their used imports when a strategy relies on them
+  bool usageFeedback = false;
+  for (auto& sharer : m_sharers)
+    for (auto& strategy : sharer->getSharingStrategies())
+      usageFeedback |= strategy->wantsUsageFeedback();
+
+  uint cdclCount = 0;
+  for (auto& solver : m_solvers) {
+    auto cdcl = std::dynamic_pointer_cast<SolverCDCLInterface>(solver);
+    if (!cdcl)
+      continue;
+    if (m_unitChannel)
+      cdcl->setUnitChannel(m_unitChannel);
+    cdcl->setExportBatching(
+      m_parameters.exportBatch,
+      std::chrono::microseconds(m_parameters.exportBatchDelay));
+    cdclCount++;
+    cdcl->setImportFilter(m_parameters.importFilter);
+    cdcl->setUsageFeedback(usageFeedback);
+  }
+  LOG1("Configured the sharing of %u CDCL solvers (unit channel: %d, export "
+       "batch: %u, import filter: %d, usage feedback: %d)",
+       cdclCount,
+       static_cast<int>(m_unitChannel != nullptr),
+       m_parameters.exportBatch,
+       static_cast<int>(m_parameters.importFilter),
+       static_cast<int>(usageFeedback));
+
+  // The strategies share the root units of the fast lane when there is one
+  if (m_parameters.sharingRootFilter) {
+    auto rootUnits =
+      m_unitChannel ? m_unitChannel : std::make_shared<UnitChannel>();
+    for (auto& sharer : m_sharers)
+      for (auto& strategy : sharer->getSharingStrategies())
+        strategy->setRootUnits(rootUnits);
+  }
+
+  if (m_parameters.sharingReinforce) {
+    for (auto& sharer : m_sharers)
+      for (auto& strategy : sharer->getSharingStrategies())
+        strategy->setReinforcement(true);
+  }
+
+  if (m_parameters.sharingSubsume > 0) {
+    for (auto& sharer : m_sharers)
+      for (auto& strategy : sharer->getSharingStrategies())
+        strategy->setSubsumption(
+          std::chrono::microseconds(m_parameters.sharingSubsume));
+  }
+
+  if (m_parameters.importBudget > 0) {
+    for (auto& sharer : m_sharers)
+      for (auto& strategy : sharer->getSharingStrategies())
+        strategy->setImportBudgets(m_parameters.importBudget,
+                                   m_parameters.importBacklog);
+  }
+}
+
 // lit_t
 // PainlessImpl::valueOf(lit_t lit)
 // {
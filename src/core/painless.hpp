@@ -4,6 +4,7 @@
 
 #include "config/Parameters.hpp"
 #include "containers/CSRMatrix.hpp"
+#include "containers/OccurrenceIndex.hpp"
 
 #include "sharing/Sharer.hpp"
 
@@ -152,6 +153,32 @@ public:
     SHARED_LOCK(std::shared_mutex, m_formulaMX, lock);
     uint clauseCount = this->clauseCount();
     uint i = startIdx;
+
+    if (m_useCompressedFormula) {
+      // Decode by batches so that the decoding cost can be measured apart
+      std::vector<lit_t> literals;
+      std::vector<std::size_t> rowEnds;
+      while (i < clauseCount) {
+        uint batchEnd = std::min<uint>(clauseCount, i + FORMULA_DECODE_BATCH);
+        auto start = std::chrono::steady_clock::now();
+        m_compressedFormula.decode_rows(i, batchEnd, literals, rowEnds);
+        m_formulaDecodeTime +=
+          std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+        m_formulaDecodedLiterals += literals.size();
+
+        std::size_t rowBegin = 0;
+        for (std::size_t rowEnd : rowEnds) {
+          clsReader(
+            clause_view_t(literals.data() + rowBegin, rowEnd - rowBegin));
+          rowBegin = rowEnd;
+        }
+        i = batchEnd;
+      }
+      return i;
+    }
+
     for (; i < clauseCount; i++) {
       // TODO make clause call a direct conversion csrMatrix row -> std::span
       // instead of passing through row_view
@@ -167,6 +194,14 @@ public:
     return readClauses<ClauseReader&>(clsReader, startIdx);
   }
 
+  /**
+   * @brief Get the literal occurrence index of the formula. It is built in
+   * parallel on the first call and cached, a later call rebuilds it only if
+   * clauses were added in between.
+   * @note Thread-safe: concurrent callers share the same build.
+   */
+  std::shared_ptr<const pl::OccurrenceIndex> getOccurrenceIndex();
+
   // Check if the atomic is still needed or enableDistributed is enough
   bool shouldEndSolving() const { return m_shouldEndSolving; }
   bool hasSolvingEnded() const { return m_solvingHasEnded; }
@@ -187,6 +222,16 @@ public:
     m_parameters = parameters;
   }
 
+  /**
+   * @brief Check a model against the formula when verifyModel is set, in
+   * parallel over row ranges, stopping at the first falsified clause.
+   * @return true if the model satisfies the formula or verification is
+   * disabled
+   * @note The strategies call it before reporting SAT, a rejected model lets
+   * the other workers continue and provide the next result.
+   */
+  bool verifyModel(model_view_t model);
+
   bool pushResult(SatAnswer answer, model_t&& model);
   bool pushResult(SatAnswer answer, model_view_t model);
 
@@ -195,6 +240,9 @@ public:
     PABORTIF(m_state >= PainlessImpl::State::INITIALIZED,
              PERR_NOT_SUPPORTED,
              "Cannot set to configured an already configured solver");
+    configureSolverSharing();
+    // The representation of the formula is fixed before its first literal
+    m_useCompressedFormula = m_parameters.compressFormula;
     m_state = PainlessImpl::State::INITIALIZED;
   }
 
@@ -208,9 +256,17 @@ public:
 
 private:
   clause_view_t clause(uint idx) { return m_formula.span_at(idx); }
-  uint clauseCount() { return m_formula.row_count(); }
+  uint clauseCount()
+  {
+    return m_useCompressedFormula ? m_compressedFormula.row_count()
+                                  : m_formula.row_count();
+  }
   bool popLastResult(result_t& result);
 
+  /// Set up the unit channel and the export batching of the CDCL solvers,
+  /// and the root units of the sharing strategies, from the parameters
+  void configureSolverSharing();
+
   // Configuration
   // -------------
 
@@ -239,6 +295,9 @@ private:
   /// Shares used in the strategy
   std::vector<std::shared_ptr<Sharer>> m_sharers;
 
+  /// Unit fast lane shared by the CDCL solvers (nullptr if disabled)
+  std::shared_ptr<UnitChannel> m_unitChannel;
+
   // Solving Lifecycle Management
   // ----------------------------
 
@@ -280,6 +339,29 @@ private:
   formula_t m_formula;
   std::shared_mutex m_formulaMX;
 
+  /// Formula when compressFormula is set, chosen by setInitialized
+  compressed_formula_t m_compressedFormula;
+  bool m_useCompressedFormula = false;
+
+  /// Lazily built occurrence lists (see getOccurrenceIndex)
+  std::shared_ptr<const pl::OccurrenceIndex> m_occurrenceIndex;
+  std::mutex m_occurrenceIndexMX;
+
+  /// Model verification statistics
+  std::atomic<uint64_t> m_verificationTime = 0;
+  std::atomic<uint> m_verifiedModels = 0;
+  std::atomic<uint> m_rejectedModels = 0;
+
+  /// Minimum number of clauses checked by a verification thread
+  static constexpr std::size_t MIN_ROWS_PER_VERIFIER = 100'000;
+
+  /// Clauses decoded per batch in readClauses
+  static constexpr uint FORMULA_DECODE_BATCH = 4096;
+
+  /// Decoding cost of the compressed formula (readers run concurrently)
+  std::atomic<uint64_t> m_formulaDecodeTime = 0;
+  std::atomic<uint64_t> m_formulaDecodedLiterals = 0;
+
   // /// Data for termination check
   // void* m_terminationData;
 
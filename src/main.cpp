@@ -1,4 +1,5 @@
 #include "config/PainlessConfigurator.hpp"
+#include "utils/ModelWriter.hpp"
 #include "utils/NumericConstants.hpp"
 #include "utils/Parsers.hpp"
 #include <future>
@@ -90,7 +91,14 @@ main(int argc, char** argv)
 
   if (result.answer == SatAnswer::SAT) {
     Logger::getInstance().logSolution("SATISFIABLE");
-    Logger::getInstance().logModel(result.model);
+    if (!painless.parameters().noModel)
+      Logger::getInstance().logModel(result.model,
+                                     painless.parameters().modelThreads);
+    if (!painless.parameters().binaryModel.empty() &&
+        !ModelWriter::writeBinaryModel(
+          painless.parameters().binaryModel.c_str(), result.model))
+      LOGERROR("Could not write the binary model to %s",
+               painless.parameters().binaryModel.c_str());
   } else if (result.answer == SatAnswer::UNSAT) {
     Logger::getInstance().logSolution("UNSATISFIABLE");
   } else // if timeout or unknown
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "containers/ClauseExchange.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+/**
+ * @brief Literals making a shared clause useless to a solver, advertised to
+ * the sharing strategies so that they do not route such clauses to it.
+ *
+ * @details A solver drops an imported clause as soon as one of its literals
+ * is on an eliminated variable or is satisfied at root level, after the clause
+ * was selected, refcounted, queued and translated. The solver publishes those
+ * literals in this bitmap (two bits per variable, one per polarity) at its
+ * inprocessing boundaries, and the strategies test it before enqueueing.
+ *
+ * The bitmap is sized once, its words are rewritten in place with relaxed
+ * stores: a reader may see a slightly stale state, which only lets a useless
+ * clause through (eliminated and root satisfied literals stay so).
+ * @ingroup sharing
+ */
+class RejectedLiterals
+{
+public:
+  /// @param varCount variables covered by the bitmap (the others always pass)
+  explicit RejectedLiterals(unsigned varCount)
+    : m_varCount(varCount)
+    , m_wordCount((2 * (size_t(varCount) + 1) + 63) / 64)
+    , m_words(new std::atomic<uint64_t>[m_wordCount]())
+  {
+  }
+
+  unsigned getVarCount() const { return m_varCount; }
+
+  /**
+   * @brief Rewrite the bitmap.
+   * @param states states[v] for v in 1..getVarCount(): bit 0 (resp. 1) set if
+   * a clause with v (resp. -v) is rejected
+   * @return number of rejected literals
+   * @note Only called by the owning solver.
+   */
+  unsigned long update(const unsigned char* states)
+  {
+    unsigned long rejected = 0;
+    for (size_t w = 0; w < m_wordCount; w++) {
+      uint64_t word = 0;
+      for (unsigned bit = 0; bit < 64; bit += 2) {
+        const size_t var = w * 32 + bit / 2;
+        if (var && var <= m_varCount)
+          word |= uint64_t(states[var] & 3) << bit;
+      }
+      rejected += std::popcount(word);
+      m_words[w].store(word, std::memory_order_relaxed);
+    }
+    return rejected;
+  }
+
+  /// True if clause has a rejected literal
+  bool rejects(const ClauseExchange& clause) const
+  {
+    for (lit_t lit : clause) {
+      const size_t var = std::abs(lit);
+      if (var > m_varCount)
+        continue;
+      const size_t bit = 2 * var + (lit < 0);
+      if (m_words[bit / 64].load(std::memory_order_relaxed) >> (bit % 64) & 1)
+        return true;
+    }
+    return false;
+  }
+
+  /// Account for a clause not routed to the owner (called by the strategies)
+  void countAvoided() const
+  {
+    m_avoided.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  unsigned long getAvoided() const { return m_avoided.load(); }
+
+private:
+  const unsigned m_varCount;
+  const size_t m_wordCount;
+  std::unique_ptr<std::atomic<uint64_t>[]> m_words;
+
+  /// Clauses the strategies did not route to the owner
+  mutable std::atomic<unsigned long> m_avoided{ 0 };
+};
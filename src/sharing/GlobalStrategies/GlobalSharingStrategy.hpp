@@ -84,7 +84,10 @@ public:
   {
     LOGD4(
       "Global Strategy %d importing a cls %p", this->getSharingId(), cls.get());
-    return m_clauseDB->addClause(cls);
+    ClauseExchangePtr stripped;
+    if (!simplifyAtIngress(cls, stripped, *m_gstats))
+      return false;
+    return m_clauseDB->addClause(stripped ? stripped : cls);
   };
 
   /**
@@ -139,7 +139,10 @@ MallobSharing::importClause(const ClauseExchangePtr& cls)
   if (cls->size > sizeLimitAtImport || cls->lbd > lbdLimitAtImport) {
     return false;
   }
-  return m_clauseDB->addClause(cls);
+  ClauseExchangePtr stripped;
+  if (!simplifyAtIngress(cls, stripped, *m_gstats))
+    return false;
+  return m_clauseDB->addClause(stripped ? stripped : cls);
 };
 
 bool
@@ -0,0 +1,149 @@
+#include "BridgeSharing.hpp"
+
+#include "utils/Logger.hpp"
+
+#include <sstream>
+
+BridgeSharing::BridgeSharing(
+  const std::shared_ptr<ClauseDatabase>& clauseDB,
+  const std::vector<std::shared_ptr<SharingEntity>>& clients)
+  : SharingStrategy(clients)
+  , m_clauseDB(clauseDB)
+  , m_stats(std::make_unique<SharingStrategy::Statistics>())
+{
+}
+
+bool
+BridgeSharing::importClause(const ClauseExchangePtr& imported)
+{
+  assert(imported->size > 0 && imported->from != -1);
+
+  // A clause this bridge forwarded comes back from the group it reached
+  if (imported->from == this->getSharingId())
+    return false;
+
+  if (imported->lbd > m_lbdLimit) {
+    m_stats->filteredAtImport++;
+    return false;
+  }
+
+  ClauseExchangePtr stripped;
+  if (!simplifyAtIngress(imported, stripped, *m_stats))
+    return false;
+  const ClauseExchangePtr& clause = stripped ? stripped : imported;
+
+  m_stats->receivedClauses++;
+  if (!m_clauseDB->addClause(clause))
+    return false;
+  signalImport(clause);
+  return true;
+}
+
+bool
+BridgeSharing::doSharing()
+{
+  selectClauses(*m_clauseDB, m_selection, m_literalsPerRound, *m_stats);
+
+  // The forwarded copy has this bridge as source: the groups do not send it
+  // back, and the group of its producer is remembered to be skipped
+  for (const ClauseExchangePtr& clause : m_selection) {
+    m_currentGroup = groupOf(clause->from);
+    this->exportClause(ClauseExchange::create(
+      clause->begin(), clause->end(), clause->lbd, this->getSharingId()));
+  }
+  m_currentGroup = -1;
+
+  m_stats->sharedClauses += m_selection.size();
+  m_selection.clear();
+
+  // Only the best clauses of the latest rounds are worth crossing groups
+  m_clauseDB->clearDatabase();
+
+  LOG2("[Bridge] received cls %ld, shared cls %ld",
+       m_stats->receivedClauses.load(),
+       m_stats->sharedClauses);
+  return true;
+}
+
+bool
+BridgeSharing::exportClauseToClient(const ClauseExchangePtr& clause,
+                                    std::shared_ptr<SharingEntity> client)
+{
+  if (m_currentGroup == client->getSharingId())
+    return false;
+  return client->importClause(clause);
+}
+
+void
+BridgeSharing::setOption(const std::string& key, int value)
+{
+  if (key == "literals-per-round")
+    m_literalsPerRound = value;
+  else if (key == "lbd-limit")
+    m_lbdLimit = value;
+  else if (key == "sleep-time-us")
+    m_sleepTime = std::chrono::microseconds(value);
+  else if (key == "sleep-time-s")
+    m_sleepTime = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::seconds(value));
+  else
+    PABORT(PERR_ARGS,
+           "Int Option %s is not recognized by BridgeSharing!",
+           key.c_str());
+}
+
+void
+BridgeSharing::setOption(const std::string& key, double value)
+{
+  long castedValue = static_cast<long>(value);
+  if (key == "literals-per-round")
+    m_literalsPerRound = castedValue;
+  else if (key == "sleep-time-us")
+    m_sleepTime = std::chrono::microseconds(castedValue);
+  else
+    PABORT(PERR_ARGS,
+           "Double Option %s is not recognized by BridgeSharing!",
+           key.c_str());
+}
+
+void
+BridgeSharing::setOption(const std::string& key, const std::string& value)
+{
+  if (key == "producer-groups")
+    m_producerGroups = value;
+  else
+    PABORT(PERR_ARGS,
+           "String Option %s is not recognized by BridgeSharing!",
+           key.c_str());
+}
+
+bool
+BridgeSharing::onConfigured()
+{
+  std::stringstream groups(m_producerGroups);
+  std::string group;
+  while (std::getline(groups, group, ';')) {
+    size_t colon = group.find(':');
+    if (colon == std::string::npos) {
+      LOGERROR("Malformed producer group '%s' in BridgeSharing",
+               group.c_str());
+      return false;
+    }
+    const int groupId = std::stoi(group.substr(0, colon));
+    std::stringstream producers(group.substr(colon + 1));
+    std::string producer;
+    while (std::getline(producers, producer, ',')) {
+      if (producer.empty())
+        continue;
+      const size_t producerId = std::stoul(producer);
+      if (m_groupOf.size() <= producerId)
+        m_groupOf.resize(producerId + 1, -1);
+      m_groupOf[producerId] = groupId;
+    }
+  }
+
+  LOGSTAT("[Bridge] lbd limit: %u, literals per round: %lu",
+          m_lbdLimit,
+          m_literalsPerRound);
+  return true;
+}
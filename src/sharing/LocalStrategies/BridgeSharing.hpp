@@ -0,0 +1,95 @@
+#pragma once
+
+#include "sharing/SharingStrategy.hpp"
+
+#include <vector>
+
+/**
+ * @brief Thin strategy forwarding the best clauses between sharing groups
+ * (e.g. the per NUMA node strategies of the `auto` topology).
+ * @details The producers and clients are the group strategies. Each round the
+ * lowest size clauses of lbd at most m_lbdLimit are selected within a small
+ * literal budget and forwarded, with this strategy as their source, to every
+ * group but the one they come from. The group of a clause is found from its
+ * producer with the `producer-groups` option: "<group sharing id>:<producer
+ * sharing id>,...;" (set by the topology builder from the producers of the
+ * group strategies).
+ * @ingroup local_sharing
+ */
+class BridgeSharing : public SharingStrategy
+{
+public:
+  BridgeSharing(
+    const std::shared_ptr<ClauseDatabase>& clauseDB,
+    const std::vector<std::shared_ptr<SharingEntity>>& clients = {});
+
+  ~BridgeSharing() {}
+
+  // SharingEntity Interface
+  // =======================
+
+  /**
+   * @brief Imports a clause of lbd at most m_lbdLimit coming from a group.
+   */
+  bool importClause(const ClauseExchangePtr& clause) override;
+
+  ImportLimits getImportLimits(int producer) const override
+  {
+    return { UINT_MAX, m_lbdLimit };
+  }
+
+  // SharingStrategy Interface
+  // =========================
+
+  /**
+   * @brief Forwards the selection of the round to the other groups.
+   */
+  bool doSharing() override;
+
+  std::chrono::microseconds getSleepingTime() override { return m_sleepTime; }
+
+  const Statistics& getStatistics() const override { return *m_stats; }
+
+protected:
+  void setOption(const std::string& key, int value) override;
+  void setOption(const std::string& key, double value) override;
+  void setOption(const std::string& key, const std::string& value) override;
+  bool onConfigured() override;
+
+  /// Skips the group of the clause being forwarded
+  bool exportClauseToClient(const ClauseExchangePtr& clause,
+                            std::shared_ptr<SharingEntity> client) override;
+
+  /// Sharing id of the group of producer, -1 if unknown
+  int groupOf(int producer) const
+  {
+    if (producer < 0 || static_cast<size_t>(producer) >= m_groupOf.size())
+      return -1;
+    return m_groupOf[producer];
+  }
+
+  /// Clause database where imported clauses are stored.
+  std::shared_ptr<ClauseDatabase> m_clauseDB;
+
+  /// Used to manipulate clauses (as a member to reduce number of allocations).
+  std::vector<ClauseExchangePtr> m_selection;
+
+  /// Time in microseconds to wait between two consicutive doSharing calls
+  std::chrono::microseconds m_sleepTime{ 500'000 };
+
+  /// Sharing statistics.
+  std::unique_ptr<Statistics> m_stats;
+
+  /// Literals forwarded per round (all groups together)
+  ulong m_literalsPerRound = 1500;
+
+  /// Largest lbd forwarded
+  unsigned m_lbdLimit = 4;
+
+  /// producer-groups option and its resolution (producer -> group)
+  std::string m_producerGroups;
+  std::vector<int> m_groupOf;
+
+  /// Group of the clause being forwarded (see exportClauseToClient)
+  int m_currentGroup = -1;
+};
@@ -0,0 +1,239 @@
+#include "GossipSharing.hpp"
+
+#include "utils/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+GossipSharing::GossipSharing(
+  const std::shared_ptr<ClauseDatabase>& clauseDB,
+  const std::vector<std::shared_ptr<SharingEntity>>& clients)
+  : SharingStrategy(clients)
+  , m_clauseDB(clauseDB)
+  , m_stats(std::make_unique<GossipSharing::Statistics>())
+  , m_rng(getSharingId())
+{
+}
+
+bool
+GossipSharing::importClause(const ClauseExchangePtr& imported)
+{
+  assert(imported->size > 0 && imported->from != -1);
+
+  ClauseExchangePtr stripped;
+  if (!simplifyAtIngress(imported, stripped, *m_stats))
+    return false;
+  const ClauseExchangePtr& clause = stripped ? stripped : imported;
+
+  m_stats->receivedClauses++;
+  if (!m_clauseDB->addClause(clause))
+    return false;
+  signalImport(clause);
+  return true;
+}
+
+void
+GossipSharing::spread(Rumor& rumor,
+                      const ClientList& clients,
+                      size_t reachLimit)
+{
+  m_candidates.clear();
+  for (unsigned pos = 0; pos < clients.size(); pos++)
+    if (!rumor.reached[pos])
+      m_candidates.push_back(pos);
+
+  const size_t room =
+    reachLimit > rumor.reachedCount ? reachLimit - rumor.reachedCount : 0;
+  const size_t targets = std::min<size_t>(
+    { rumor.senders * m_fanout, m_candidates.size(), room });
+  const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - rumor.selected);
+
+  // Partial Fisher-Yates: the first targets candidates are a random subset
+  rumor.senders = 0;
+  for (size_t i = 0; i < targets; i++) {
+    std::uniform_int_distribution<size_t> pick(i, m_candidates.size() - 1);
+    std::swap(m_candidates[i], m_candidates[pick(m_rng)]);
+    const unsigned pos = m_candidates[i];
+
+    // A client rejecting the clause still holds the rumor and forwards it
+    rumor.reached[pos] = true;
+    rumor.reachedCount++;
+    rumor.senders++;
+    exportClauseTo(rumor.clause, clients[pos]);
+
+    m_stats->deliveries++;
+    m_stats->hopSum += rumor.hops;
+    m_stats->latencySum += latency;
+  }
+  rumor.hops++;
+}
+
+size_t
+GossipSharing::getReachLimit(size_t clientCount) const
+{
+  return std::max<size_t>(1, std::ceil(m_coverage * clientCount));
+}
+
+unsigned
+GossipSharing::getHopLimit(size_t reachLimit) const
+{
+  if (m_maxHops)
+    return m_maxHops;
+
+  // Smallest h with 1 + f + ... + f^h >= reachLimit
+  unsigned hops = 0;
+  for (size_t reach = 1, layer = 1; reach < reachLimit; hops++) {
+    layer *= m_fanout;
+    reach += layer;
+  }
+  return hops;
+}
+
+bool
+GossipSharing::doSharing()
+{
+  const ClientsGuard snapshot = getClients();
+  const ClientList& clients = *snapshot;
+  const size_t reachLimit = getReachLimit(clients.size());
+  const unsigned long deliveries = m_stats->deliveries;
+
+  // Step 1: the disseminations in progress go one hop further
+  for (Rumor& rumor : m_rumors) {
+    // The client positions changed, it cannot be followed
+    if (rumor.reached.size() != clients.size())
+      rumor.senders = 0;
+    else
+      spread(rumor, clients, reachLimit);
+  }
+
+  // Step 2: the new selection is pushed by its producers
+  selectClauses(*m_clauseDB,
+                m_selection,
+                m_literalsPerProducerPerRound * m_producerCount,
+                *m_stats);
+  const auto now = std::chrono::steady_clock::now();
+  for (const ClauseExchangePtr& clause : m_selection) {
+    Rumor rumor{ clause, now, std::vector<bool>(clients.size()), 0, 1, 0 };
+    for (unsigned pos = 0; pos < clients.size(); pos++) {
+      if (clients[pos]->getSharingId() == clause->from) {
+        rumor.reached[pos] = true;
+        rumor.reachedCount = 1;
+      }
+    }
+    m_stats->allToAllDeliveries += clients.size() - rumor.reachedCount;
+    spread(rumor, clients, reachLimit);
+    m_rumors.push_back(std::move(rumor));
+  }
+  m_stats->sharedClauses += m_selection.size();
+  m_selection.clear();
+
+  // Step 3: retire the disseminations that cannot go further
+  const unsigned hopLimit = getHopLimit(reachLimit);
+  auto over = [this, &clients, hopLimit, reachLimit](const Rumor& rumor) {
+    if (rumor.senders && rumor.hops < hopLimit &&
+        rumor.reachedCount < reachLimit)
+      return false;
+    m_stats->finished++;
+    if (!clients.empty())
+      m_stats->coverageSum +=
+        static_cast<double>(rumor.reachedCount) / clients.size();
+    return true;
+  };
+  m_rumors.erase(std::remove_if(m_rumors.begin(), m_rumors.end(), over),
+                 m_rumors.end());
+
+  const unsigned long saved =
+    m_stats->allToAllDeliveries > m_stats->deliveries
+      ? m_stats->allToAllDeliveries - m_stats->deliveries
+      : 0;
+  LOG2("[Gossip] received cls %ld, shared cls %ld, deliveries %ld (%lu this "
+       "round, %lu saved over an export to all), in progress %zu",
+       m_stats->receivedClauses.load(),
+       m_stats->sharedClauses,
+       m_stats->deliveries,
+       m_stats->deliveries - deliveries,
+       saved,
+       m_rumors.size());
+  return true;
+}
+
+void
+GossipSharing::setOption(const std::string& key, int value)
+{
+  if (key == "literals-per-producer-per-round")
+    m_literalsPerProducerPerRound = value;
+  else if (key == "fanout")
+    m_fanout = value;
+  else if (key == "max-hops")
+    m_maxHops = value;
+  else if (key == "coverage")
+    m_coverage = value;
+  else if (key == "seed")
+    m_rng.seed(value);
+  else if (key == "sleep-time-us")
+    m_sleepTime = std::chrono::microseconds(value);
+  else if (key == "sleep-time-s")
+    m_sleepTime = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::seconds(value));
+  else
+    PABORT(PERR_ARGS,
+           "Int Option %s is not recognized by GossipSharing!",
+           key.c_str());
+}
+
+void
+GossipSharing::setOption(const std::string& key, double value)
+{
+  long castedValue = static_cast<long>(value);
+  if (key == "literals-per-producer-per-round")
+    m_literalsPerProducerPerRound = castedValue;
+  else if (key == "coverage")
+    m_coverage = value;
+  else if (key == "sleep-time-us")
+    m_sleepTime = std::chrono::microseconds(castedValue);
+  else
+    PABORT(PERR_ARGS,
+           "Double Option %s is not recognized by GossipSharing!",
+           key.c_str());
+}
+
+void
+GossipSharing::setOption(const std::string& key, const std::string& value)
+{
+  if (key == "producer-ids")
+    m_producersList = value;
+  else
+    PABORT(PERR_ARGS,
+           "String Option %s is not recognized by GossipSharing!",
+           key.c_str());
+}
+
+bool
+GossipSharing::onConfigured()
+{
+  // Every id of the list is followed by a comma
+  m_producerCount =
+    std::count(m_producersList.begin(), m_producersList.end(), ',');
+  if (!m_producerCount) {
+    LOGERROR("Cannot initialize GossipSharing with 0 producerCount");
+    return false;
+  }
+  if (!m_fanout) {
+    LOGERROR("GossipSharing needs a fanout of at least 1");
+    return false;
+  }
+  if (!(m_coverage > 0 && m_coverage <= 1)) {
+    LOGERROR("GossipSharing needs a coverage in (0, 1], got %f", m_coverage);
+    return false;
+  }
+
+  LOGSTAT("[Gossip] %u producers, fanout: %u, max hops: %u (0: automatic), "
+          "coverage: %.2f, literals per producer per round: %lu",
+          m_producerCount,
+          m_fanout,
+          m_maxHops,
+          m_coverage,
+          m_literalsPerProducerPerRound);
+  return true;
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "sharing/SharingStrategy.hpp"
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Randomized gossip strategy for many clients.
+ * @details HordeSatSharing and SimpleSharing export every selected clause to
+ * every client, which makes the import traffic quadratic in the number of
+ * solvers. Here each round selects the best clauses (within a literal budget
+ * per producer) and pushes each of them to m_fanout random clients. The next
+ * rounds every client reached at the previous hop forwards it in turn to
+ * m_fanout clients not reached yet: after h hops (the first push included), a
+ * clause is held by at most 1 + f + ... + f^h clients, in h rounds.
+ *
+ * A dissemination stops once ceil(m_coverage * n) of the n clients hold the
+ * clause (its producer included), or after `max-hops` hops when set. Each
+ * clause thus costs about m_coverage * n imports instead of the n - 1 of an
+ * export to all: the traffic is divided by 1 / m_coverage, and the clauses
+ * spread by several producers still reach most clients.
+ *
+ * The forwarding is done by the strategy on behalf of the clients (they do
+ * not re-export what they import), so a clause is never delivered twice to a
+ * client, and all the deliveries are made by the strategy thread. Coverage,
+ * latency and the deliveries saved over an export to all are reported in the
+ * statistics.
+ *
+ * The producers are given with the `producer-ids` option, as for
+ * HordeSatSharing (set by the topology builder).
+ * @ingroup local_sharing
+ */
+class GossipSharing : public SharingStrategy
+{
+public:
+  /// Statistics of the disseminations
+  struct Statistics : public SharingStrategy::Statistics
+  {
+    /// Clauses delivered to a client
+    unsigned long deliveries{ 0 };
+
+    /// Disseminations over (max hops, all clients reached or dead end)
+    unsigned long finished{ 0 };
+
+    /// Sum over the finished disseminations of their reached client ratio
+    double coverageSum{ 0 };
+
+    /// Sum over the deliveries of the hop they happened at
+    unsigned long hopSum{ 0 };
+
+    /// Sum over the deliveries of the time since the clause was selected
+    std::chrono::microseconds latencySum{ 0 };
+
+    /// Deliveries an export to all clients would have made
+    unsigned long allToAllDeliveries{ 0 };
+
+    std::string toString() const override
+    {
+      std::ostringstream oss;
+      oss << SharingStrategy::Statistics::toString();
+      oss << " -deliveries: " << deliveries << std::endl;
+      oss << " -finishedDisseminations: " << finished << std::endl;
+      oss << " -meanCoverage: " << (finished ? coverageSum / finished : 0)
+          << std::endl;
+      oss << " -meanHops: "
+          << (deliveries ? static_cast<double>(hopSum) / deliveries : 0)
+          << std::endl;
+      oss << " -meanLatencyMs: "
+          << (deliveries ? latencySum.count() / 1000.0 / deliveries : 0)
+          << std::endl;
+      oss << " -savedDeliveries: "
+          << (allToAllDeliveries > deliveries ? allToAllDeliveries - deliveries
+                                              : 0)
+          << std::endl;
+      return oss.str();
+    }
+  };
+
+  GossipSharing(
+    const std::shared_ptr<ClauseDatabase>& clauseDB,
+    const std::vector<std::shared_ptr<SharingEntity>>& clients = {});
+
+  ~GossipSharing() {}
+
+  // SharingEntity Interface
+  // =======================
+
+  /**
+   * @brief Imports a clause of one of the producers.
+   */
+  bool importClause(const ClauseExchangePtr& clause) override;
+
+  // SharingStrategy Interface
+  // =========================
+
+  /**
+   * @brief Moves the disseminations in progress one hop further, then starts
+   * the ones of the new selection.
+   */
+  bool doSharing() override;
+
+  std::chrono::microseconds getSleepingTime() override { return m_sleepTime; }
+
+  const Statistics& getStatistics() const override { return *m_stats; }
+
+protected:
+  void setOption(const std::string& key, int value) override;
+  void setOption(const std::string& key, double value) override;
+  void setOption(const std::string& key, const std::string& value) override;
+  bool onConfigured() override;
+
+  /// A clause being disseminated
+  struct Rumor
+  {
+    ClauseExchangePtr clause;
+    std::chrono::steady_clock::time_point selected;
+
+    /// Clients (positions in the client snapshot) that have the clause
+    std::vector<bool> reached;
+    unsigned reachedCount;
+
+    /// Clients reached at the last hop, they forward it at the next one
+    unsigned senders;
+    unsigned hops;
+  };
+
+  /// Forward the rumor one hop further, until reachLimit clients hold it
+  void spread(Rumor& rumor, const ClientList& clients, size_t reachLimit);
+
+  /// Clients holding a clause at the end of its dissemination (see
+  /// m_coverage)
+  size_t getReachLimit(size_t clientCount) const;
+
+  /// Hops of a dissemination reaching reachLimit clients (see m_maxHops)
+  unsigned getHopLimit(size_t reachLimit) const;
+
+  /// Clause database where imported clauses are stored.
+  std::shared_ptr<ClauseDatabase> m_clauseDB;
+
+  /// Used to manipulate clauses (as a member to reduce number of allocations).
+  std::vector<ClauseExchangePtr> m_selection;
+
+  /// Disseminations in progress
+  std::vector<Rumor> m_rumors;
+
+  /// Clients not reached by the rumor being spread (reused buffer)
+  std::vector<unsigned> m_candidates;
+
+  /// Time in microseconds to wait between two consicutive doSharing calls
+  std::chrono::microseconds m_sleepTime{ 500'000 };
+
+  /// Sharing statistics.
+  std::unique_ptr<Statistics> m_stats;
+
+  /// Literals selected per producer per round
+  ulong m_literalsPerProducerPerRound = 1500;
+
+  /// Clients each holder forwards a clause to per hop
+  unsigned m_fanout = 2;
+
+  /// Hops of a dissemination, the first push included (0: enough to reach
+  /// the coverage)
+  unsigned m_maxHops = 0;
+
+  /// Fraction of the clients a dissemination reaches, in (0, 1]
+  double m_coverage = 0.5;
+
+  /// producer-ids option and the number of producers it lists
+  std::string m_producersList;
+  unsigned m_producerCount = 0;
+
+  std::mt19937 m_rng;
+};
@@ -53,13 +53,23 @@ HordeSatSharing::~HordeSatSharing()
 }
 
 bool
-HordeSatSharing::importClause(const ClauseExchangePtr& clause)
+HordeSatSharing::importClause(const ClauseExchangePtr& imported)
 {
-  assert(clause->size > 0 && clause->from != -1);
+  assert(imported->size > 0 && imported->from != -1);
 
-  // The producer id
-  uint pidx = clause->from;
-  assert(m_producerCount > pidx);
+  ClauseExchangePtr stripped;
+  if (!simplifyAtIngress(imported, stripped, *m_stats))
+    return false;
+  const ClauseExchangePtr& clause = stripped ? stripped : imported;
+
+  // The producer index
+  const int producer = producerIndex(clause->from);
+  if (producer < 0) {
+    LOGD4("Clause from %d which is not a producer", clause->from);
+    m_stats->filteredAtImport++;
+    return false;
+  }
+  const uint pidx = producer;
 
   LOGD4("Producer %d: Clause with lbd %d is tested against limit %d",
         clause->from,
@@ -75,6 +85,7 @@ HordeSatSharing::importClause(const ClauseExchangePtr& clause)
     m_stats->receivedClauses++;
     if (m_clauseDB->addClause(clause)) {
       m_literalsPerProducer[pidx] += clause->size;
+      signalImport(clause);
       return true;
     } else
       return false;
@@ -84,18 +95,29 @@ HordeSatSharing::importClause(const ClauseExchangePtr& clause)
   }
 }
 
+SharingEntity::ImportLimits
+HordeSatSharing::getImportLimits(int producer) const
+{
+  ImportLimits limits;
+  const int pidx = producerIndex(producer);
+  if (pidx >= 0 && m_lbdLimitPerProducer)
+    limits.lbd = m_lbdLimitPerProducer[pidx];
+  return limits;
+}
+
 bool
 HordeSatSharing::doSharing()
 {
   // Step 1: Get new clause selection
-  this->m_clauseDB->giveSelection(
-    m_selection, m_literalsPerProducerPerRound * m_producerCount);
+  this->selectClauses(*m_clauseDB,
+                      m_selection,
+                      m_literalsPerProducerPerRound * m_producerCount,
+                      *m_stats);
 
   // Step 2: Process producers
   for (uint pidx = 0; pidx < m_producerCount; pidx++) {
     const ulong produced = m_literalsPerProducer[pidx].load();
-    const ulong producedPercent =
-      (100 * produced) / m_literalsPerProducerPerRound;
+    const ulong producedPercent = (100 * produced) / getProducerTarget(pidx);
 
     LOG3("[HordeSat] Production rate of %d = %d", pidx, producedPercent);
 
@@ -124,7 +146,7 @@ HordeSatSharing::doSharing()
         m_selection.size());
 
   // Step 3: Export clauses to clients
-  this->exportClauses(m_selection);
+  this->exportClausesWithinBudgets(m_selection, *m_stats);
 
   // Step 4: Clear selection vector
   m_selection.clear();
@@ -202,6 +224,15 @@ HordeSatSharing::onConfigured()
 
   m_producerCount = producerIds.size();
 
+  // Producers are indexed in their declaration order
+  m_producerIndex.clear();
+  for (uint pidx = 0; pidx < m_producerCount; pidx++) {
+    const size_t sharingId = producerIds[pidx];
+    if (m_producerIndex.size() <= sharingId)
+      m_producerIndex.resize(sharingId + 1, -1);
+    m_producerIndex[sharingId] = pidx;
+  }
+
   if (!m_producerCount) {
     LOGERROR("Cannot initialize Hordesat with 0 producerCount");
     return false;
@@ -69,13 +69,19 @@ public:
    */
   bool importClause(const ClauseExchangePtr& clause) override;
 
+  /**
+   * @brief The current lbd limit of the producer.
+   */
+  ImportLimits getImportLimits(int producer) const override;
+
   // SharingStrategy Interface
   // =========================
 
   /**
    * @brief Performs the sharing operation. It checks the literal production to
    * decide if the lbd limit should be increased, decreased or unchanged. The
-   * selection of clauses from the database is exported to all clients
+   * selection of clauses from the database is exported to all clients, within
+   * their import budgets if enabled (see SharingStrategy::setImportBudgets)
    * @return True if the sharing didn't encounter an error, false otherwise.
    */
   bool doSharing() override;
@@ -93,6 +99,24 @@ protected:
   void setOption(const std::string& key, const std::string& value) override;
   bool onConfigured() override;
 
+  /**
+   * @brief Literals the producer pidx should export per round, its lbd limit
+   * is tuned to reach it.
+   */
+  virtual ulong getProducerTarget(uint pidx) const
+  {
+    return m_literalsPerProducerPerRound;
+  }
+
+  /// Index of the producer of sharing id sharingId, -1 if not a producer
+  int producerIndex(int sharingId) const
+  {
+    if (sharingId < 0 ||
+        static_cast<size_t>(sharingId) >= m_producerIndex.size())
+      return -1;
+    return m_producerIndex[sharingId];
+  }
+
   /// Time in microseconds to wait between two consicutive doSharing calls
   std::chrono::microseconds m_sleepTime;
 
@@ -129,6 +153,9 @@ protected:
 
   std::string m_producersList;
 
+  /// Sharing id -> producer index (see producerIndex)
+  std::vector<int> m_producerIndex;
+
   // Data accessible from other threads via importClause
   // ---------------------------------------------------
 
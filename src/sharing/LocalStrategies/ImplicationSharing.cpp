@@ -0,0 +1,418 @@
+#include "ImplicationSharing.hpp"
+
+#include "utils/Logger.hpp"
+
+#include <algorithm>
+#include <climits>
+
+namespace {
+constexpr uint32_t NONE = UINT32_MAX;
+
+unsigned long
+elapsedUs(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+           std::chrono::steady_clock::now() - start)
+    .count();
+}
+} // namespace
+
+ImplicationSharing::ImplicationSharing(
+  const std::shared_ptr<ClauseDatabase>& clauseDB,
+  const std::vector<std::shared_ptr<SharingEntity>>& clients)
+  : SharingStrategy(clients)
+  , m_clauseDB(clauseDB)
+{
+}
+
+bool
+ImplicationSharing::importClause(const ClauseExchangePtr& clause)
+{
+  assert(clause->size > 0 && clause->from != -1);
+
+  if (clause->size > 2) {
+    m_stats.filteredAtImport++;
+    return false;
+  }
+
+  m_stats.receivedClauses++;
+  if (!m_clauseDB->addClause(clause))
+    return false;
+  signalImport(clause);
+  return true;
+}
+
+bool
+ImplicationSharing::addBinary(lit_t first, lit_t second)
+{
+  if (first == -second || m_binaryKeys.size() >= m_maxBinaries)
+    return false;
+
+  const uint32_t a = std::min(node(first), node(second));
+  const uint32_t b = std::max(node(first), node(second));
+  if (!m_binaryKeys.insert(static_cast<uint64_t>(a) << 32 | b).second)
+    return false;
+
+  m_binaries.push_back(a);
+  m_binaries.push_back(b);
+  m_maxNode = std::max(m_maxNode, b | 1);
+  m_stats.graphBinaries++;
+  return true;
+}
+
+bool
+ImplicationSharing::shouldRebuild() const
+{
+  const size_t graph = m_graphEnd / 2;
+  const size_t pending = (m_binaries.size() - m_graphEnd) / 2;
+  return pending && (graph + pending <= SMALL_GRAPH ||
+                     pending >= m_rebuildRatio * static_cast<double>(graph));
+}
+
+void
+ImplicationSharing::computeComponents()
+{
+  const auto start = std::chrono::steady_clock::now();
+  const uint32_t nodes = m_maxNode + 1;
+  m_graphEnd = m_binaries.size();
+
+  // CSR graph, (a ∨ b) gives ¬a → b and ¬b → a
+  m_offsets.assign(nodes + 1, 0);
+  for (size_t i = 0; i < m_binaries.size(); i += 2) {
+    m_offsets[(m_binaries[i] ^ 1) + 1]++;
+    m_offsets[(m_binaries[i + 1] ^ 1) + 1]++;
+  }
+  for (uint32_t n = 0; n < nodes; n++)
+    m_offsets[n + 1] += m_offsets[n];
+  m_targets.resize(m_binaries.size());
+  std::vector<uint32_t> fill(m_offsets.begin(), m_offsets.end() - 1);
+  for (size_t i = 0; i < m_binaries.size(); i += 2) {
+    m_targets[fill[m_binaries[i] ^ 1]++] = m_binaries[i + 1];
+    m_targets[fill[m_binaries[i + 1] ^ 1]++] = m_binaries[i];
+  }
+
+  // Iterative Tarjan, a visited node without component is on the stack
+  std::vector<uint32_t> index(nodes, NONE);
+  std::vector<uint32_t> low(nodes);
+  std::vector<uint32_t> stack;
+  std::vector<std::pair<uint32_t, uint32_t>> calls;
+  m_component.assign(nodes, NONE);
+  m_componentRep.clear();
+  uint32_t counter = 0;
+
+  for (uint32_t root = 2; root < nodes; root++) {
+    if (index[root] != NONE || m_offsets[root] == m_offsets[root + 1])
+      continue;
+    index[root] = low[root] = counter++;
+    stack.push_back(root);
+    calls.push_back({ root, m_offsets[root] });
+
+    while (!calls.empty()) {
+      const uint32_t v = calls.back().first;
+      if (calls.back().second < m_offsets[v + 1]) {
+        const uint32_t w = m_targets[calls.back().second++];
+        if (index[w] == NONE) {
+          index[w] = low[w] = counter++;
+          stack.push_back(w);
+          calls.push_back({ w, m_offsets[w] });
+        } else if (m_component[w] == NONE) {
+          low[v] = std::min(low[v], index[w]);
+        }
+        continue;
+      }
+
+      if (low[v] == index[v]) {
+        // The representative is the literal of the smallest variable
+        uint32_t rep = v;
+        uint32_t member;
+        do {
+          member = stack.back();
+          stack.pop_back();
+          m_component[member] = m_componentRep.size();
+          if ((member >> 1) < (rep >> 1))
+            rep = member;
+        } while (member != v);
+        m_componentRep.push_back(rep);
+      }
+      calls.pop_back();
+      if (!calls.empty()) {
+        const uint32_t u = calls.back().first;
+        low[u] = std::min(low[u], low[v]);
+      }
+    }
+  }
+
+  // Roots of the condensed graph
+  m_isRoot.assign(m_componentRep.size(), true);
+  for (uint32_t u = 2; u < nodes; u++)
+    for (uint32_t e = m_offsets[u]; e < m_offsets[u + 1]; e++)
+      if (m_component[u] != m_component[m_targets[e]])
+        m_isRoot[m_component[m_targets[e]]] = false;
+
+  // The components are renumbered, the rotation of the probing goes on
+  m_probeDone = false;
+  if (m_probeStart >= m_componentRep.size())
+    m_probeStart = 0;
+  if (m_stamps.size() < nodes)
+    m_stamps.resize(nodes, 0);
+  if (m_representative.size() < nodes / 2)
+    m_representative.resize(nodes / 2, 0);
+
+  m_stats.sccRuns++;
+  m_stats.sccTimeUs += elapsedUs(start);
+}
+
+void
+ImplicationSharing::exportEquivalences()
+{
+  for (uint32_t v = 2; v < m_component.size(); v += 2) {
+    if (m_component[v] == NONE)
+      continue;
+
+    if (m_component[v] == m_component[v ^ 1]) {
+      LOG1("[Implications] %d and %d are equivalent, the formula is UNSAT",
+           literal(v),
+           literal(v ^ 1));
+      exportUnit(v);
+      exportUnit(v ^ 1);
+      m_unsat = true;
+      return;
+    }
+
+    // Positive nodes only, the negated component is the mirror
+    const uint32_t rep = m_componentRep[m_component[v]];
+    const lit_t repLit = rep == v ? 0 : literal(rep);
+    if (m_representative[v >> 1] == repLit)
+      continue;
+    m_representative[v >> 1] = repLit;
+    if (!repLit)
+      continue;
+
+    const lit_t lit = literal(v);
+    const lit_t first[2] = { -lit, repLit };
+    const lit_t second[2] = { lit, -repLit };
+    exportClause(ClauseExchange::create(first, first + 2, 2, getSharingId()));
+    exportClause(
+      ClauseExchange::create(second, second + 2, 2, getSharingId()));
+    m_stats.sharedClauses += 2;
+    m_stats.equivalences++;
+  }
+}
+
+void
+ImplicationSharing::probeRoots()
+{
+  const auto start = std::chrono::steady_clock::now();
+  const uint32_t components = m_componentRep.size();
+  unsigned long visits = 0;
+
+  for (uint32_t k = 0; k < components && !m_unsat; k++) {
+    const uint32_t c = (m_probeStart + k) % components;
+    const uint32_t root = m_componentRep[c];
+    const uint32_t target = m_component[root ^ 1];
+    if (!m_isRoot[c] || value(root) || target == NONE)
+      continue;
+    if (visits >= m_probeBudget) {
+      m_probeStart = c;
+      m_stats.probeVisits += visits;
+      m_stats.probeTimeUs += elapsedUs(start);
+      return;
+    }
+    m_stats.probedRoots++;
+
+    if (!++m_stamp) {
+      std::fill(m_stamps.begin(), m_stamps.end(), 0);
+      m_stamp = 1;
+    }
+    bool failed = false;
+    m_queue.assign(1, root);
+    m_stamps[root] = m_stamp;
+    for (size_t i = 0; i < m_queue.size() && !failed; i++) {
+      const uint32_t u = m_queue[i];
+      for (uint32_t e = m_offsets[u]; e < m_offsets[u + 1]; e++) {
+        const uint32_t w = m_targets[e];
+        visits++;
+        if (m_component[w] == target) {
+          failed = true;
+          break;
+        }
+        if (m_stamps[w] != m_stamp) {
+          m_stamps[w] = m_stamp;
+          m_queue.push_back(w);
+        }
+      }
+    }
+
+    if (failed) {
+      m_stats.failedLiterals++;
+      propagateUnit(root ^ 1, false);
+    }
+  }
+
+  m_probeDone = true;
+  m_stats.probeVisits += visits;
+  m_stats.probeTimeUs += elapsedUs(start);
+}
+
+void
+ImplicationSharing::propagateUnit(uint32_t unit, bool imported)
+{
+  if (m_unsat || value(unit) > 0)
+    return;
+
+  m_queue.clear();
+  auto assign = [this](uint32_t n) {
+    const size_t var = n >> 1;
+    if (m_values.size() <= var)
+      m_values.resize(var + 1, 0);
+    m_values[var] = n & 1 ? -1 : 1;
+    m_queue.push_back(n);
+  };
+
+  if (value(unit) < 0) {
+    LOG1("[Implications] units %d and %d are known, the formula is UNSAT",
+         literal(unit),
+         literal(unit ^ 1));
+    exportUnit(unit);
+    exportUnit(unit ^ 1);
+    m_unsat = true;
+    return;
+  }
+  assign(unit);
+  if (!imported)
+    exportUnit(unit);
+
+  for (size_t i = 0; i < m_queue.size(); i++) {
+    const uint32_t u = m_queue[i];
+    if (u + 1 >= m_offsets.size())
+      continue;
+    for (uint32_t e = m_offsets[u]; e < m_offsets[u + 1]; e++) {
+      const uint32_t w = m_targets[e];
+      const int val = value(w);
+      if (val > 0)
+        continue;
+      if (val < 0) {
+        LOG1("[Implications] units %d and %d are implied, the formula is "
+             "UNSAT",
+             literal(w),
+             literal(w ^ 1));
+        exportUnit(w);
+        exportUnit(w ^ 1);
+        m_unsat = true;
+        return;
+      }
+      assign(w);
+      exportUnit(w);
+    }
+  }
+}
+
+void
+ImplicationSharing::propagateNewBinaries(size_t first)
+{
+  for (size_t i = first; i < m_binaries.size() && !m_unsat; i += 2) {
+    const uint32_t a = m_binaries[i];
+    const uint32_t b = m_binaries[i + 1];
+    if (value(a) < 0)
+      propagateUnit(b, false);
+    else if (value(b) < 0)
+      propagateUnit(a, false);
+  }
+}
+
+void
+ImplicationSharing::propagatePendingBinaries()
+{
+  // A unit derived through the graph can make an earlier pending binary unit
+  unsigned long derived;
+  do {
+    derived = m_stats.derivedUnits;
+    propagateNewBinaries(m_graphEnd);
+  } while (!m_unsat && m_stats.derivedUnits != derived);
+}
+
+void
+ImplicationSharing::exportUnit(uint32_t unit)
+{
+  const lit_t lit = literal(unit);
+  exportClause(ClauseExchange::create(&lit, &lit + 1, 1, getSharingId()));
+  m_stats.sharedClauses++;
+  m_stats.derivedUnits++;
+}
+
+bool
+ImplicationSharing::doSharing()
+{
+  m_clauseDB->getClauses(m_incoming);
+  if (m_unsat) {
+    m_incoming.clear();
+    return true;
+  }
+
+  const size_t firstNew = m_binaries.size();
+  m_units.clear();
+  for (const ClauseExchangePtr& clause : m_incoming) {
+    if (clause->size == 1)
+      m_units.push_back(clause->lits[0]);
+    else
+      addBinary(clause->lits[0], clause->lits[1]);
+  }
+  m_incoming.clear();
+
+  if (shouldRebuild()) {
+    computeComponents();
+    exportEquivalences();
+    propagateNewBinaries(firstNew);
+  } else if (m_binaries.size() > firstNew) {
+    m_stats.deferredRebuilds++;
+  }
+  for (lit_t unit : m_units)
+    propagateUnit(node(unit), true);
+  if (m_graphEnd < m_binaries.size())
+    propagatePendingBinaries();
+  if (!m_probeDone)
+    probeRoots();
+
+  LOG2("[Implications] %lu binaries, %lu equivalences, %lu failed literals, "
+       "%lu derived units, scc time %lu us, probe time %lu us",
+       m_stats.graphBinaries,
+       m_stats.equivalences,
+       m_stats.failedLiterals,
+       m_stats.derivedUnits,
+       m_stats.sccTimeUs,
+       m_stats.probeTimeUs);
+  return true;
+}
+
+void
+ImplicationSharing::setOption(const std::string& key, int value)
+{
+  if (key == "probe-budget")
+    m_probeBudget = value;
+  else if (key == "max-binaries")
+    m_maxBinaries = value;
+  else if (key == "rebuild-ratio")
+    m_rebuildRatio = value;
+  else if (key == "sleep-time-us")
+    m_sleepTime = std::chrono::microseconds(value);
+  else if (key == "sleep-time-s")
+    m_sleepTime = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::seconds(value));
+  else
+    PABORT(PERR_ARGS,
+           "Int Option %s is not recognized by ImplicationSharing!",
+           key.c_str());
+}
+
+void
+ImplicationSharing::setOption(const std::string& key, double value)
+{
+  if (key == "rebuild-ratio")
+    m_rebuildRatio = value;
+  else if (key == "sleep-time-us")
+    m_sleepTime = std::chrono::microseconds(static_cast<long>(value));
+  else
+    PABORT(PERR_ARGS,
+           "Double Option %s is not recognized by ImplicationSharing!",
+           key.c_str());
+}
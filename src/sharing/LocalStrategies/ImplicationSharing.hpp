@@ -0,0 +1,236 @@
+#pragma once
+
+#include "sharing/SharingStrategy.hpp"
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Derives equivalent literals and units from the binary implication
+ * graph of all the shared binaries.
+ * @details Each producer only sees its own imports, this strategy accumulates
+ * every unit and binary its producers share (the larger clauses are rejected
+ * before being created, see getImportLimits). Each round:
+ * - when enough new binaries arrived, the graph (edges ¬a→b and ¬b→a per
+ *   binary) is rebuilt in CSR form and an iterative Tarjan computes its
+ *   strongly connected components. A rebuild costs the size of the whole
+ *   graph, so once the graph is past SMALL_GRAPH binaries it waits for
+ *   `rebuild-ratio` times its size of new binaries, the cost per binary stays
+ *   constant. The literals of a component are equivalent: each new
+ *   equivalence l ≡ r (r the literal of the smallest variable of the
+ *   component) is sent as the binaries (¬l ∨ r) and (l ∨ ¬r). A component
+ *   holding a literal and its negation makes the formula UNSAT, both units are
+ *   sent;
+ * - the roots of the condensed graph are probed once per graph, bounded by
+ *   `probe-budget` edge visits per round (the next round resumes after the
+ *   last probed root): a root reaching its negation is a failed literal, its
+ *   negation is a unit;
+ * - the known units are propagated along the new binaries, the new units
+ *   along all the implications (the graph and the binaries waiting for the
+ *   next rebuild), every derived unit is sent.
+ *
+ * Only the derived clauses are sent to the clients, the imported ones still go
+ * through the other strategies of the topology.
+ * @ingroup local_sharing
+ */
+class ImplicationSharing : public SharingStrategy
+{
+public:
+  /// Cost and output of the graph analysis
+  struct Statistics : public SharingStrategy::Statistics
+  {
+    /// Distinct binaries in the graph
+    unsigned long graphBinaries{ 0 };
+
+    /// Graph rebuilds with an SCC computation, and their total time
+    unsigned long sccRuns{ 0 };
+    unsigned long sccTimeUs{ 0 };
+
+    /// Rounds whose new binaries were left for a later rebuild
+    unsigned long deferredRebuilds{ 0 };
+
+    /// Root probing
+    unsigned long probedRoots{ 0 };
+    unsigned long probeVisits{ 0 };
+    unsigned long probeTimeUs{ 0 };
+
+    /// Equivalences sent (two binaries each)
+    unsigned long equivalences{ 0 };
+
+    /// Failed literals found by probing
+    unsigned long failedLiterals{ 0 };
+
+    /// Units sent (failed literals and propagated units)
+    unsigned long derivedUnits{ 0 };
+
+    std::string toString() const override
+    {
+      std::ostringstream oss;
+      oss << SharingStrategy::Statistics::toString();
+      oss << " -graphBinaries: " << graphBinaries << std::endl;
+      oss << " -sccRuns: " << sccRuns << std::endl;
+      oss << " -sccTimeUs: " << sccTimeUs << std::endl;
+      oss << " -deferredRebuilds: " << deferredRebuilds << std::endl;
+      oss << " -probedRoots: " << probedRoots << std::endl;
+      oss << " -probeVisits: " << probeVisits << std::endl;
+      oss << " -probeTimeUs: " << probeTimeUs << std::endl;
+      oss << " -equivalences: " << equivalences << std::endl;
+      oss << " -failedLiterals: " << failedLiterals << std::endl;
+      oss << " -derivedUnits: " << derivedUnits << std::endl;
+      return oss.str();
+    }
+  };
+
+  ImplicationSharing(
+    const std::shared_ptr<ClauseDatabase>& clauseDB,
+    const std::vector<std::shared_ptr<SharingEntity>>& clients = {});
+
+  ~ImplicationSharing() {}
+
+  // SharingEntity Interface
+  // =======================
+
+  /**
+   * @brief Imports a unit or a binary of a producer.
+   */
+  bool importClause(const ClauseExchangePtr& clause) override;
+
+  ImportLimits getImportLimits(int producer) const override
+  {
+    return { 2, UINT_MAX };
+  }
+
+  // SharingStrategy Interface
+  // =========================
+
+  /**
+   * @brief Adds the clauses of the round to the graph and sends what it
+   * derives.
+   */
+  bool doSharing() override;
+
+  std::chrono::microseconds getSleepingTime() override { return m_sleepTime; }
+
+  const Statistics& getStatistics() const override { return m_stats; }
+
+protected:
+  void setOption(const std::string& key, int value) override;
+  void setOption(const std::string& key, double value) override;
+
+  /// Graph node of a literal, its negation is node ^ 1
+  static uint32_t node(lit_t lit)
+  {
+    return 2 * static_cast<uint32_t>(std::abs(lit)) + (lit < 0);
+  }
+
+  static lit_t literal(uint32_t node)
+  {
+    const lit_t var = node >> 1;
+    return node & 1 ? -var : var;
+  }
+
+  /// Value of a node: 1 true, -1 false, 0 unknown
+  int value(uint32_t node) const
+  {
+    const size_t var = node >> 1;
+    if (var >= m_values.size() || !m_values[var])
+      return 0;
+    return node & 1 ? -m_values[var] : m_values[var];
+  }
+
+  /// Add a binary to the graph, false if it was known
+  bool addBinary(lit_t first, lit_t second);
+
+  /// The binaries waiting for the graph are worth a rebuild
+  bool shouldRebuild() const;
+
+  /// Rebuild the CSR graph and compute its components
+  void computeComponents();
+
+  /// Send the new equivalences of the components
+  void exportEquivalences();
+
+  /// Probe the roots of the condensed graph within the budget
+  void probeRoots();
+
+  /**
+   * @brief Set the unit of node and propagate it along the implications.
+   * @param imported the unit comes from a producer, it is not sent again
+   */
+  void propagateUnit(uint32_t node, bool imported);
+
+  /**
+   * @brief Propagate the known units along the binaries added since first (a
+   * position in m_binaries): a binary with a false literal implies the other.
+   */
+  void propagateNewBinaries(size_t first);
+
+  /// Propagate along the binaries waiting for the graph up to a fixpoint
+  void propagatePendingBinaries();
+
+  /// Send a unit (a derived one or one half of a conflict)
+  void exportUnit(uint32_t node);
+
+  /// Clause database where imported clauses are stored.
+  std::shared_ptr<ClauseDatabase> m_clauseDB;
+
+  /// Clauses and units of the round (reused buffers)
+  std::vector<ClauseExchangePtr> m_incoming;
+  std::vector<lit_t> m_units;
+
+  /// Distinct binaries (two nodes per binary) and their keys
+  std::vector<uint32_t> m_binaries;
+  std::unordered_set<uint64_t> m_binaryKeys;
+
+  /// Largest node of the graph
+  uint32_t m_maxNode = 1;
+
+  /// End of the binaries of the CSR graph in m_binaries, the next ones wait
+  /// for a rebuild
+  size_t m_graphEnd = 0;
+
+  /// CSR graph, the successors of n are in
+  /// m_targets[m_offsets[n]..m_offsets[n + 1]]
+  std::vector<uint32_t> m_offsets;
+  std::vector<uint32_t> m_targets;
+
+  /// Component of each node (NONE for a node without edge), components are
+  /// numbered successors first
+  std::vector<uint32_t> m_component;
+
+  /// Per component: its node of the smallest variable, no incoming edge
+  std::vector<uint32_t> m_componentRep;
+  std::vector<bool> m_isRoot;
+
+  /// Per variable: literal it was last sent as equivalent to (0 if none)
+  std::vector<lit_t> m_representative;
+
+  /// Root value of each variable (1, -1, 0 unknown)
+  std::vector<int8_t> m_values;
+
+  /// A conflict was found, the graph is not used anymore
+  bool m_unsat = false;
+
+  /// Probing: the pass over the roots of the current graph is done, else the
+  /// component it resumes at, stamps of the visits
+  bool m_probeDone = true;
+  uint32_t m_probeStart = 0;
+  std::vector<uint32_t> m_stamps;
+  uint32_t m_stamp = 0;
+
+  /// Nodes to visit (reused buffer)
+  std::vector<uint32_t> m_queue;
+
+  unsigned long m_probeBudget = 1'000'000;
+  size_t m_maxBinaries = 1'000'000;
+
+  /// Graphs up to this number of binaries are rebuilt for every new binary
+  static constexpr size_t SMALL_GRAPH = 1 << 16;
+  double m_rebuildRatio = 0.1;
+
+  /// Time in microseconds to wait between two consicutive doSharing calls
+  std::chrono::microseconds m_sleepTime{ 500'000 };
+
+  Statistics m_stats;
+};
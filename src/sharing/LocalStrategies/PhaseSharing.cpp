@@ -0,0 +1,67 @@
+#include "PhaseSharing.hpp"
+
+#include "utils/Logger.hpp"
+#include "utils/StringUtils.hpp"
+
+PhaseSharing::PhaseSharing()
+  : SharingStrategy({})
+  , m_channel(std::make_shared<PhaseChannel>())
+{
+}
+
+bool
+PhaseSharing::doSharing()
+{
+  const unsigned contributions = m_channel->aggregate();
+  if (!contributions)
+    return true;
+
+  m_stats.hints++;
+  m_stats.contributions += contributions;
+  LOGD1("[Phases] hint %lu from %u contributions",
+        m_stats.hints,
+        contributions);
+  return true;
+}
+
+void
+PhaseSharing::setOption(const std::string& key, int value)
+{
+  if (key == "period-us" || key == "sleep-time-us")
+    m_channel->setPeriod(std::chrono::microseconds(value));
+  else if (key == "period-s" || key == "sleep-time-s")
+    m_channel->setPeriod(std::chrono::seconds(value));
+  else
+    PABORT(PERR_ARGS,
+           "Int Option %s is not recognized by PhaseSharing!",
+           key.c_str());
+}
+
+void
+PhaseSharing::setOption(const std::string& key, double value)
+{
+  if (key == "period-us" || key == "sleep-time-us")
+    m_channel->setPeriod(std::chrono::microseconds(static_cast<long>(value)));
+  else if (key == "period-s" || key == "sleep-time-s")
+    m_channel->setPeriod(std::chrono::microseconds(
+      static_cast<long>(value * 1'000'000)));
+  else
+    PABORT(PERR_ARGS,
+           "Double Option %s is not recognized by PhaseSharing!",
+           key.c_str());
+}
+
+void
+PhaseSharing::setOption(const std::string& key, const std::string& value)
+{
+  const std::string policy = pl::str::toLower(value);
+  if (key == "policy" && policy == "majority")
+    m_channel->setPolicy(PhaseChannel::Policy::MAJORITY);
+  else if (key == "policy" && policy == "best")
+    m_channel->setPolicy(PhaseChannel::Policy::BEST);
+  else
+    PABORT(PERR_ARGS,
+           "String Option %s=%s is not recognized by PhaseSharing!",
+           key.c_str(),
+           value.c_str());
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "sharing/PhaseChannel.hpp"
+#include "sharing/SharingStrategy.hpp"
+
+/**
+ * @brief Shares phases instead of clauses: aggregates the phases published on
+ * its PhaseChannel into a hint for the subscribed solvers.
+ * @details The topology builder connects the producers and clients of the
+ * strategy (CDCL solvers or local searchers) to the channel with
+ * SolverInterface::addPhaseChannel, no clause goes through the strategy. Each
+ * round merges the phases published since the previous one (see
+ * PhaseChannel::aggregate), the solvers publish and poll at their own points,
+ * at most once per `period-us`.
+ *
+ * Options: `policy` ("majority" or "best", the assignment with the least unsat
+ * clauses of a local searcher), `period-us` / `period-s`.
+ * @ingroup local_sharing
+ */
+class PhaseSharing : public SharingStrategy
+{
+public:
+  /// Statistics of the phase aggregation
+  struct Statistics : public SharingStrategy::Statistics
+  {
+    /// Hints produced
+    unsigned long hints{ 0 };
+
+    /// Phase vectors merged into the hints
+    unsigned long contributions{ 0 };
+
+    std::string toString() const override
+    {
+      std::ostringstream oss;
+      oss << SharingStrategy::Statistics::toString();
+      oss << " -phaseHints: " << hints << std::endl;
+      oss << " -phaseContributions: " << contributions << std::endl;
+      return oss.str();
+    }
+  };
+
+  PhaseSharing();
+
+  ~PhaseSharing() {}
+
+  /// The channel to connect the solvers to
+  const std::shared_ptr<PhaseChannel>& getChannel() const { return m_channel; }
+
+  // SharingEntity Interface
+  // =======================
+
+  /**
+   * @brief No clause is shared through this strategy.
+   */
+  bool importClause(const ClauseExchangePtr& clause) override { return false; }
+
+  // SharingStrategy Interface
+  // =========================
+
+  /**
+   * @brief Merges the phases published since the last round into a new hint.
+   */
+  bool doSharing() override;
+
+  std::chrono::microseconds getSleepingTime() override
+  {
+    return m_channel->getPeriod();
+  }
+
+  const Statistics& getStatistics() const override { return m_stats; }
+
+protected:
+  void setOption(const std::string& key, int value) override;
+  void setOption(const std::string& key, double value) override;
+  void setOption(const std::string& key, const std::string& value) override;
+
+  std::shared_ptr<PhaseChannel> m_channel;
+
+  Statistics m_stats;
+};
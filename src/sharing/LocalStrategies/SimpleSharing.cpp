@@ -29,9 +29,14 @@ SimpleSharing::SimpleSharing(
 SimpleSharing::~SimpleSharing() {}
 
 bool
-SimpleSharing::importClause(const ClauseExchangePtr& clause)
+SimpleSharing::importClause(const ClauseExchangePtr& imported)
 {
-  assert(clause->size > 0 && clause->from != -1);
+  assert(imported->size > 0 && imported->from != -1);
+
+  ClauseExchangePtr stripped;
+  if (!simplifyAtIngress(imported, stripped, *m_stats))
+    return false;
+  const ClauseExchangePtr& clause = stripped ? stripped : imported;
 
   int id = clause->from;
 
@@ -42,7 +47,10 @@ SimpleSharing::importClause(const ClauseExchangePtr& clause)
 
   if (clause->size <= this->m_sizeLimit) {
     m_stats->receivedClauses++;
-    return m_clauseDB->addClause(clause);
+    if (!m_clauseDB->addClause(clause))
+      return false;
+    signalImport(clause);
+    return true;
   } else {
     m_stats->filteredAtImport++;
     return false;
@@ -54,12 +62,12 @@ SimpleSharing::doSharing()
 {
   // 1- Get selection
   // consumer receives the same amount as in the original
-  this->m_clauseDB->giveSelection(m_selection, m_literalsPerRound);
+  this->selectClauses(*m_clauseDB, m_selection, m_literalsPerRound, *m_stats);
 
   m_stats->sharedClauses += m_selection.size();
 
   // 2-Send the best clauses (all producers included) to all clients
-  this->exportClauses(m_selection);
+  this->exportClausesWithinBudgets(m_selection, *m_stats);
 
   LOGD2("TotalSize: %ld => selectedClauses: %ld, DB size: %ld",
         m_literalsPerRound,
@@ -48,6 +48,12 @@ public:
    */
   bool importClause(const ClauseExchangePtr& clause) override;
 
+  /// Clauses above sizeLimit are never imported
+  ImportLimits getImportLimits(int producer) const override
+  {
+    return { m_sizeLimit, UINT_MAX };
+  }
+
   // SharingStrategy Interface
   // =========================
 
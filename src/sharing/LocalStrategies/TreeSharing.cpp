@@ -0,0 +1,273 @@
+#include "TreeSharing.hpp"
+
+#include "utils/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+TreeSharing::TreeSharing(
+  const std::shared_ptr<ClauseDatabase>& clauseDB,
+  const std::vector<std::shared_ptr<SharingEntity>>& clients)
+  : SharingStrategy(clients)
+  , m_clauseDB(clauseDB)
+  , m_stats(std::make_unique<TreeSharing::Statistics>())
+{
+}
+
+bool
+TreeSharing::importClause(const ClauseExchangePtr& imported)
+{
+  assert(imported->size > 0 && imported->from != -1);
+
+  // Only the producers have a leaf in the tree
+  if (groupOf(imported->from) < 0 || imported->size > m_sizeLimit ||
+      imported->lbd > m_lbdLimit) {
+    m_stats->filteredAtImport++;
+    return false;
+  }
+
+  ClauseExchangePtr stripped;
+  if (!simplifyAtIngress(imported, stripped, *m_stats))
+    return false;
+  const ClauseExchangePtr& clause = stripped ? stripped : imported;
+
+  m_stats->receivedClauses++;
+  if (!m_clauseDB->addClause(clause))
+    return false;
+  signalImport(clause);
+  return true;
+}
+
+unsigned
+TreeSharing::computeBufferSize(unsigned count) const
+{
+  const float base = static_cast<float>(m_baseSize);
+  const float max = static_cast<float>(m_maxSize);
+  const float size =
+    max - (max - base) * std::exp((base / (base - max)) * (count - 1));
+  return std::ceil(size);
+}
+
+void
+TreeSharing::computeCompensation()
+{
+  if (m_estimatedIncomingLits <= 0)
+    m_estimatedIncomingLits = m_lastRoundReceivedLits;
+  if (m_estimatedSharedLits <= 0)
+    m_estimatedSharedLits = m_lastRoundAdmittedLits;
+  else {
+    const size_t rootSize = computeBufferSize(m_groupCount);
+    m_accumulatedAdmittedLiterals =
+      0.9f * m_accumulatedAdmittedLiterals + m_lastRoundAdmittedLits;
+    m_accumulatedDesiredLiterals =
+      std::max(1.f,
+               0.9f * m_accumulatedDesiredLiterals +
+                 std::min(m_lastRoundReceivedLits, rootSize));
+
+    m_estimatedIncomingLits =
+      0.6f * m_estimatedIncomingLits +
+      0.4f * (m_lastRoundReceivedLits / m_compensationFactor);
+    m_estimatedSharedLits =
+      0.6f * m_estimatedSharedLits +
+      0.4f * (m_lastRoundAdmittedLits / m_compensationFactor);
+  }
+
+  m_compensationFactor =
+    m_estimatedSharedLits <= 0
+      ? 1.0f
+      : ((m_accumulatedDesiredLiterals - m_accumulatedAdmittedLiterals +
+          m_estimatedIncomingLits) /
+         m_estimatedSharedLits);
+  m_compensationFactor =
+    std::max(0.1f, std::min(m_maxCompensationFactor, m_compensationFactor));
+}
+
+void
+TreeSharing::mergeNode(unsigned node)
+{
+  std::vector<ClauseExchangePtr>& buffer = m_buffers[node];
+  for (unsigned child = 2 * node + 1; child <= 2 * node + 2; child++) {
+    if (child >= m_groupCount)
+      break;
+    buffer.insert(buffer.end(),
+                  std::make_move_iterator(m_buffers[child].begin()),
+                  std::make_move_iterator(m_buffers[child].end()));
+    m_buffers[child].clear();
+  }
+
+  std::sort(buffer.begin(),
+            buffer.end(),
+            [](const ClauseExchangePtr& a, const ClauseExchangePtr& b) {
+              return a->size != b->size ? a->size < b->size : a->lbd < b->lbd;
+            });
+
+  const size_t limit =
+    std::ceil(m_compensationFactor * computeBufferSize(m_subtreeGroups[node]));
+  size_t literals = 0;
+  size_t kept = 0;
+  m_merged.clear();
+  for (size_t i = 0; i < buffer.size(); i++) {
+    if (!m_merged.insert(buffer[i]).second) {
+      m_stats->mergeDuplicates++;
+      continue;
+    }
+    // Sorted by size: once a clause does not fit, the next ones do not either
+    if (buffer[i]->size > m_freeSize) {
+      if (literals + buffer[i]->size > limit) {
+        m_stats->droppedAtMerge += buffer.size() - i;
+        break;
+      }
+      literals += buffer[i]->size;
+    }
+    buffer[kept++] = std::move(buffer[i]);
+  }
+  buffer.resize(kept);
+}
+
+bool
+TreeSharing::doSharing()
+{
+  computeCompensation();
+  m_lastRoundReceivedLits = 0;
+  m_lastRoundAdmittedLits = 0;
+  m_round++;
+
+  // Leaves: the clauses of the round, by group of their producer
+  m_clauseDB->getClauses(m_incoming);
+  for (ClauseExchangePtr& clause : m_incoming)
+    m_buffers[groupOf(clause->from)].push_back(std::move(clause));
+  m_incoming.clear();
+
+  // Heap order: the children of a node are merged before it
+  for (unsigned node = m_groupCount; node-- > 0;)
+    mergeNode(node);
+
+  // Root: what was shared recently is not sent again
+  std::vector<ClauseExchangePtr>& root = m_buffers[0];
+  for (const ClauseExchangePtr& clause : root) {
+    if (clause->size > m_freeSize)
+      m_lastRoundReceivedLits += clause->size;
+
+    auto [it, inserted] = m_sharedRound.try_emplace(clause, m_round);
+    if (!inserted) {
+      if (m_round - it->second < m_resharePeriod) {
+        m_stats->reshareFiltered++;
+        continue;
+      }
+      it->second = m_round;
+    }
+
+    if (clause->size > m_freeSize)
+      m_lastRoundAdmittedLits += clause->size;
+    m_stats->sharedClauses++;
+    exportClause(clause);
+  }
+  root.clear();
+
+  std::erase_if(m_sharedRound, [this](const auto& entry) {
+    return m_round - entry.second >= m_resharePeriod;
+  });
+
+  LOG2("[Tree] received cls %ld, shared cls %ld, admitted lits %zu/%zu, "
+       "compensation %.2f",
+       m_stats->receivedClauses.load(),
+       m_stats->sharedClauses,
+       m_lastRoundAdmittedLits,
+       m_lastRoundReceivedLits,
+       m_compensationFactor);
+  return true;
+}
+
+void
+TreeSharing::setOption(const std::string& key, int value)
+{
+  if (key == "group-size")
+    m_groupSize = value;
+  else if (key == "base-buffer-size")
+    m_baseSize = value;
+  else if (key == "max-buffer-size")
+    m_maxSize = value;
+  else if (key == "free-size")
+    m_freeSize = value;
+  else if (key == "reshare-period")
+    m_resharePeriod = value;
+  else if (key == "lbd-limit")
+    m_lbdLimit = value;
+  else if (key == "size-limit")
+    m_sizeLimit = value;
+  else if (key == "sleep-time-us")
+    m_sleepTime = std::chrono::microseconds(value);
+  else if (key == "sleep-time-s")
+    m_sleepTime = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::seconds(value));
+  else
+    PABORT(PERR_ARGS,
+           "Int Option %s is not recognized by TreeSharing!",
+           key.c_str());
+}
+
+void
+TreeSharing::setOption(const std::string& key, double value)
+{
+  if (key == "max-compensation")
+    m_maxCompensationFactor = value;
+  else if (key == "sleep-time-us")
+    m_sleepTime = std::chrono::microseconds(static_cast<long>(value));
+  else
+    PABORT(PERR_ARGS,
+           "Double Option %s is not recognized by TreeSharing!",
+           key.c_str());
+}
+
+void
+TreeSharing::setOption(const std::string& key, const std::string& value)
+{
+  if (key == "producer-ids")
+    m_producersList = value;
+  else
+    PABORT(PERR_ARGS,
+           "String Option %s is not recognized by TreeSharing!",
+           key.c_str());
+}
+
+bool
+TreeSharing::onConfigured()
+{
+  if (!m_groupSize || m_baseSize >= m_maxSize) {
+    LOGERROR("TreeSharing needs a group size of at least 1 and a base buffer "
+             "size below the max buffer size");
+    return false;
+  }
+
+  // Every id of the list is followed by a comma, the groups follow its order
+  unsigned producerCount = 0;
+  std::stringstream producers(m_producersList);
+  std::string producer;
+  while (std::getline(producers, producer, ',')) {
+    if (producer.empty())
+      continue;
+    const size_t producerId = std::stoul(producer);
+    if (m_groupOf.size() <= producerId)
+      m_groupOf.resize(producerId + 1, -1);
+    m_groupOf[producerId] = producerCount++ / m_groupSize;
+  }
+  if (!producerCount) {
+    LOGERROR("Cannot initialize TreeSharing with 0 producerCount");
+    return false;
+  }
+
+  m_groupCount = (producerCount + m_groupSize - 1) / m_groupSize;
+  m_buffers.resize(m_groupCount);
+  m_subtreeGroups.assign(m_groupCount, 1);
+  for (unsigned node = m_groupCount; node-- > 1;)
+    m_subtreeGroups[(node - 1) / 2] += m_subtreeGroups[node];
+
+  LOGSTAT("[Tree] %u producers in %u groups, root buffer: %u literals, "
+          "reshare period: %u rounds",
+          producerCount,
+          m_groupCount,
+          computeBufferSize(m_groupCount),
+          m_resharePeriod);
+  return true;
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "containers/ClauseUtils.hpp"
+#include "sharing/SharingStrategy.hpp"
+
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief In-process version of the MallobSharing aggregation, over a tree of
+ * producer groups instead of MPI ranks.
+ * @details The producers (`producer-ids` option, set by the topology builder)
+ * are split, in their order, into groups of m_groupSize. The groups form a
+ * binary tree in heap order (group i has children 2i+1 and 2i+2). Each round,
+ * bottom-up, a node merges the clauses of its group with the buffers of its
+ * children: by increasing size then lbd, without duplicates, up to the volume
+ * given by the MallobSharing curve for the number of groups below it (times
+ * the compensation factor). The root buffer, minus the clauses shared in the
+ * last m_resharePeriod rounds, is then sent to every client. The clauses not
+ * fitting a buffer are dropped.
+ *
+ * The compensation factor is computed as in MallobSharing: it grows when the
+ * reshare filter removes part of the root buffer, to keep the shared volume
+ * near the curve.
+ * @ingroup local_sharing
+ */
+class TreeSharing : public SharingStrategy
+{
+public:
+  /// Statistics of the aggregation
+  struct Statistics : public SharingStrategy::Statistics
+  {
+    /// Clauses met twice in a merge
+    unsigned long mergeDuplicates{ 0 };
+
+    /// Clauses not fitting the buffer of a node
+    unsigned long droppedAtMerge{ 0 };
+
+    /// Clauses of the root buffer already shared recently
+    unsigned long reshareFiltered{ 0 };
+
+    std::string toString() const override
+    {
+      std::ostringstream oss;
+      oss << SharingStrategy::Statistics::toString();
+      oss << " -mergeDuplicates: " << mergeDuplicates << std::endl;
+      oss << " -droppedAtMerge: " << droppedAtMerge << std::endl;
+      oss << " -reshareFiltered: " << reshareFiltered << std::endl;
+      return oss.str();
+    }
+  };
+
+  TreeSharing(const std::shared_ptr<ClauseDatabase>& clauseDB,
+              const std::vector<std::shared_ptr<SharingEntity>>& clients = {});
+
+  ~TreeSharing() {}
+
+  // SharingEntity Interface
+  // =======================
+
+  /**
+   * @brief Imports a clause of one of the producers.
+   */
+  bool importClause(const ClauseExchangePtr& clause) override;
+
+  // SharingStrategy Interface
+  // =========================
+
+  /**
+   * @brief Aggregates the clauses of the round up the tree and shares the root
+   * buffer.
+   */
+  bool doSharing() override;
+
+  std::chrono::microseconds getSleepingTime() override { return m_sleepTime; }
+
+  const Statistics& getStatistics() const override { return *m_stats; }
+
+protected:
+  void setOption(const std::string& key, int value) override;
+  void setOption(const std::string& key, double value) override;
+  void setOption(const std::string& key, const std::string& value) override;
+  bool onConfigured() override;
+
+  /// Group of the producer of sharing id producer, -1 if not a producer
+  int groupOf(int producer) const
+  {
+    if (producer < 0 || static_cast<size_t>(producer) >= m_groupOf.size())
+      return -1;
+    return m_groupOf[producer];
+  }
+
+  /**
+   * @brief Literal volume of a buffer aggregating count groups (the
+   * MallobSharing::computeBufferSize curve, from m_baseSize to m_maxSize).
+   */
+  unsigned computeBufferSize(unsigned count) const;
+
+  /// Same as MallobSharing::computeCompensation, once per round
+  void computeCompensation();
+
+  /// Merge the group of node with the buffers of its children
+  void mergeNode(unsigned node);
+
+  /// Clause database where imported clauses are stored.
+  std::shared_ptr<ClauseDatabase> m_clauseDB;
+
+  /// Clauses of the round (reused buffer)
+  std::vector<ClauseExchangePtr> m_incoming;
+
+  /// Per node: clauses of its group, then its merged buffer
+  std::vector<std::vector<ClauseExchangePtr>> m_buffers;
+
+  /// Per node: number of groups in its subtree
+  std::vector<unsigned> m_subtreeGroups;
+
+  /// Clauses of the merge in progress (reused buffer)
+  std::unordered_set<ClauseExchangePtr,
+                     ClauseUtils::ClauseExchangePtrHash,
+                     ClauseUtils::ClauseExchangePtrEqual>
+    m_merged;
+
+  /// Round at which a clause was last shared, see m_resharePeriod
+  std::unordered_map<ClauseExchangePtr,
+                     unsigned,
+                     ClauseUtils::ClauseExchangePtrHash,
+                     ClauseUtils::ClauseExchangePtrEqual>
+    m_sharedRound;
+
+  /// Time in microseconds to wait between two consicutive doSharing calls
+  std::chrono::microseconds m_sleepTime{ 500'000 };
+
+  /// Sharing statistics.
+  std::unique_ptr<Statistics> m_stats;
+
+  /// Producers per group
+  unsigned m_groupSize = 4;
+
+  /// Buffer size of a single group and upper bound of the curve
+  unsigned m_baseSize = 6000;
+  unsigned m_maxSize = 100'000;
+
+  /// Clauses up to this size are not counted in the buffer sizes
+  unsigned m_freeSize = 1;
+
+  /// Rounds before a shared clause can be shared again
+  unsigned m_resharePeriod = 30;
+
+  /// Import filters
+  unsigned m_lbdLimit = std::numeric_limits<unsigned>::max();
+  unsigned m_sizeLimit = std::numeric_limits<unsigned>::max();
+
+  unsigned m_round = 0;
+
+  /// producer-ids option and its resolution (producer -> group)
+  std::string m_producersList;
+  std::vector<int> m_groupOf;
+  unsigned m_groupCount = 0;
+
+  // Volume compensation (see MallobSharing)
+  float m_compensationFactor = 1.0f;
+  float m_maxCompensationFactor = 5.0f;
+  float m_accumulatedAdmittedLiterals = 0;
+  float m_accumulatedDesiredLiterals = 0;
+  size_t m_lastRoundAdmittedLits = 0;
+  size_t m_lastRoundReceivedLits = 0;
+  float m_estimatedIncomingLits = 0;
+  float m_estimatedSharedLits = -1.0f;
+};
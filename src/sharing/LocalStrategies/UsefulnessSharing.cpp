@@ -0,0 +1,127 @@
+#include "UsefulnessSharing.hpp"
+#include "utils/Logger.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+UsefulnessSharing::UsefulnessSharing(
+  const uint producerCount,
+  const ulong literalsPerProducerPerRound,
+  const lbd_t initialLbdLimit,
+  const uint roundsBeforeLbdIncrease,
+  const std::chrono::microseconds sleepTime,
+  const std::shared_ptr<ClauseDatabase>& clauseDB,
+  const std::vector<std::shared_ptr<SharingEntity>>& clients)
+  : HordeSatSharing(producerCount,
+                    literalsPerProducerPerRound,
+                    initialLbdLimit,
+                    roundsBeforeLbdIncrease,
+                    sleepTime,
+                    clauseDB,
+                    clients)
+{
+}
+
+UsefulnessSharing::UsefulnessSharing(
+  const std::shared_ptr<ClauseDatabase>& clauseDB,
+  const std::vector<std::shared_ptr<SharingEntity>>& clients)
+  : HordeSatSharing(clauseDB, clients)
+{
+}
+
+UsefulnessSharing::~UsefulnessSharing()
+{
+  std::stringstream sstr;
+  sstr << "\n";
+  for (uint pid = 0; pid < m_weights.size(); pid++) {
+    sstr << "c Producer " << pid << " : weight " << m_weights[pid]
+         << ", used clauses " << m_totalUsed[pid] << ", shared literals "
+         << m_totalLiterals[pid] << std::endl;
+  }
+  LOGSTAT("[Usefulness]%s", sstr.str().c_str());
+}
+
+void
+UsefulnessSharing::notifyClauseUsed(int producer)
+{
+  const int pidx = producerIndex(producer);
+  if (pidx >= 0)
+    m_usedPerProducer[pidx].fetch_add(1, std::memory_order_relaxed);
+}
+
+bool
+UsefulnessSharing::doSharing()
+{
+  reweightProducers();
+  return HordeSatSharing::doSharing();
+}
+
+ulong
+UsefulnessSharing::getProducerTarget(uint pidx) const
+{
+  return std::max<ulong>(1, m_literalsPerProducerPerRound * m_weights[pidx]);
+}
+
+void
+UsefulnessSharing::reweightProducers()
+{
+  // HordeSatSharing::doSharing resets the literals counters after us
+  std::vector<double> rates(m_producerCount);
+  for (uint pidx = 0; pidx < m_producerCount; pidx++) {
+    const ulong used = m_usedPerProducer[pidx].exchange(0);
+    const ulong literals = m_literalsPerProducer[pidx].load();
+    m_totalUsed[pidx] += used;
+    m_totalLiterals[pidx] += literals;
+    m_usedWindow[pidx] = WINDOW_DECAY * m_usedWindow[pidx] + used;
+    m_literalsWindow[pidx] = WINDOW_DECAY * m_literalsWindow[pidx] + literals;
+
+    // The default budget as prior keeps a silent producer near the mean
+    rates[pidx] = (m_usedWindow[pidx] + 1) /
+                  (m_literalsWindow[pidx] + m_literalsPerProducerPerRound);
+  }
+
+  // Weights clamp(rate * scale) with a mean of 1. Their sum grows with the
+  // scale, from MIN_WEIGHT to MAX_WEIGHT per producer, the scale is found by
+  // bisection (the rates are positive).
+  auto weightSum = [&](double scale) {
+    double sum = 0;
+    for (uint pidx = 0; pidx < m_producerCount; pidx++)
+      sum += std::clamp(rates[pidx] * scale, MIN_WEIGHT, MAX_WEIGHT);
+    return sum;
+  };
+  double low = 0;
+  double high = MAX_WEIGHT / *std::min_element(rates.begin(), rates.end());
+  for (unsigned step = 0; step < WEIGHT_BISECTION_STEPS; step++) {
+    const double scale = (low + high) / 2;
+    (weightSum(scale) < m_producerCount ? low : high) = scale;
+  }
+  for (uint pidx = 0; pidx < m_producerCount; pidx++)
+    m_weights[pidx] = std::clamp(rates[pidx] * high, MIN_WEIGHT, MAX_WEIGHT);
+
+  for (uint pidx = 0; pidx < m_producerCount; pidx++)
+    LOG3("[Usefulness] Producer %u: %.0f used clauses for %.0f literals, "
+         "weight %.2f",
+         pidx,
+         m_usedWindow[pidx],
+         m_literalsWindow[pidx],
+         m_weights[pidx]);
+}
+
+bool
+UsefulnessSharing::onConfigured()
+{
+  if (!HordeSatSharing::onConfigured())
+    return false;
+
+  m_usedPerProducer = std::make_unique<std::atomic<ulong>[]>(m_producerCount);
+  m_usedWindow.assign(m_producerCount, 0);
+  m_literalsWindow.assign(m_producerCount, 0);
+  m_weights.assign(m_producerCount, 1.0);
+  m_totalUsed.assign(m_producerCount, 0);
+  m_totalLiterals.assign(m_producerCount, 0);
+
+  LOGSTAT("[Usefulness] %u producers, literals per round: %lu",
+          m_producerCount,
+          m_literalsPerProducerPerRound);
+  return true;
+}
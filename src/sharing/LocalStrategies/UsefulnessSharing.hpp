@@ -0,0 +1,89 @@
+#pragma once
+
+#include "sharing/LocalStrategies/HordeSatSharing.hpp"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief HordeSat-like sharing whose per producer literal budgets follow the
+ * usefulness of the producers' clauses.
+ * @details The consumers report each imported clause the first time it takes
+ * part in one of their conflict analyses (see
+ * SharingEntity::notifyClauseUsed). Every round, the used clauses and the
+ * shared literals of each producer are accumulated in decaying windows, their
+ * ratio gives the producer's usefulness per shared literal. The HordeSat
+ * target of a producer is the default budget scaled by its usefulness relative
+ * to the mean one (within [MIN_WEIGHT, MAX_WEIGHT]), its lbd limit then
+ * follows: a producer whose clauses are used gets a looser limit and a larger
+ * share of the round's selection, a producer whose clauses are not gets a
+ * tighter one. The common scale of the clamped weights keeps their mean at 1,
+ * so the total budget of a round is unchanged (up to the rounding of the
+ * targets).
+ * @warning Same initialization requirements as HordeSatSharing.
+ * @ingroup local_sharing
+ */
+class UsefulnessSharing : public HordeSatSharing
+{
+public:
+  /// Same parameters as HordeSatSharing
+  UsefulnessSharing(
+    const uint producerCount,
+    const ulong literalsPerProducerPerRound,
+    const lbd_t initialLbdLimit,
+    const uint roundsBeforeLbdIncrease,
+    const std::chrono::microseconds sleepTime,
+    const std::shared_ptr<ClauseDatabase>& clauseDB,
+    const std::vector<std::shared_ptr<SharingEntity>>& clients = {});
+
+  UsefulnessSharing(
+    const std::shared_ptr<ClauseDatabase>& clauseDB,
+    const std::vector<std::shared_ptr<SharingEntity>>& clients = {});
+
+  ~UsefulnessSharing();
+
+  /**
+   * @brief Count a used clause of producer.
+   */
+  void notifyClauseUsed(int producer) override;
+
+  /**
+   * @brief Reweights the producers' targets, then shares as HordeSatSharing.
+   */
+  bool doSharing() override;
+
+  bool wantsUsageFeedback() const override { return true; }
+
+protected:
+  bool onConfigured() override;
+
+  ulong getProducerTarget(uint pidx) const override;
+
+  /// Update the windows and the weights with the round's counters
+  void reweightProducers();
+
+  /// Decay of the usefulness windows per round
+  static constexpr double WINDOW_DECAY = 0.9;
+
+  /// Bounds of a producer's weight relative to the default budget
+  static constexpr double MIN_WEIGHT = 0.25;
+  static constexpr double MAX_WEIGHT = 4.0;
+
+  /// Bisection steps of the weights' scale (see reweightProducers)
+  static constexpr unsigned WEIGHT_BISECTION_STEPS = 50;
+
+  /// Used clauses reported since the previous round (written by consumers)
+  std::unique_ptr<std::atomic<ulong>[]> m_usedPerProducer;
+
+  /// Decaying windows of used clauses and shared literals
+  std::vector<double> m_usedWindow;
+  std::vector<double> m_literalsWindow;
+
+  /// Budget weight of each producer (read by getProducerTarget)
+  std::vector<double> m_weights;
+
+  /// Totals for the final statistics
+  std::vector<ulong> m_totalUsed;
+  std::vector<ulong> m_totalLiterals;
+};
@@ -0,0 +1,74 @@
+#include "sharing/PhaseChannel.hpp"
+
+#include <algorithm>
+
+int
+PhaseChannel::join()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_contributions.emplace_back();
+  return m_contributions.size() - 1;
+}
+
+void
+PhaseChannel::publish(int slot, const Phases& phases, unsigned unsatCount)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Contribution& contribution = m_contributions.at(slot);
+  contribution.phases = phases;
+  contribution.unsatCount = unsatCount;
+  contribution.fresh = true;
+}
+
+unsigned
+PhaseChannel::aggregate()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  unsigned fresh = 0;
+  const Contribution* best = nullptr;
+  size_t size = 0;
+  for (const Contribution& contribution : m_contributions) {
+    if (!contribution.fresh)
+      continue;
+    fresh++;
+    size = std::max(size, contribution.phases.size());
+    if (contribution.unsatCount != NO_UNSAT_COUNT &&
+        (!best || contribution.unsatCount < best->unsatCount))
+      best = &contribution;
+  }
+  if (!fresh)
+    return 0;
+
+  std::shared_ptr<Phases> hint;
+  if (m_policy == Policy::BEST && best) {
+    hint = std::make_shared<Phases>(best->phases);
+  } else {
+    m_votes.assign(size, 0);
+    for (const Contribution& contribution : m_contributions) {
+      if (!contribution.fresh)
+        continue;
+      for (size_t var = 1; var < contribution.phases.size(); var++)
+        m_votes[var] += contribution.phases[var];
+    }
+    hint = std::make_shared<Phases>(size, 0);
+    for (size_t var = 1; var < size; var++)
+      (*hint)[var] = (m_votes[var] > 0) - (m_votes[var] < 0);
+  }
+
+  for (Contribution& contribution : m_contributions)
+    contribution.fresh = false;
+  m_hint = std::move(hint);
+  m_version.fetch_add(1, std::memory_order_release);
+  return fresh;
+}
+
+std::shared_ptr<const PhaseChannel::Phases>
+PhaseChannel::poll(uint64_t& cursor) const
+{
+  if (m_version.load(std::memory_order_acquire) == cursor)
+    return nullptr;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  cursor = m_version.load(std::memory_order_relaxed);
+  return m_hint;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Phase sharing between solvers, aggregated by a PhaseSharing
+ * strategy or by a LocalSearchGuide.
+ *
+ * @details The contributors publish a full phase vector (index = variable, 1,
+ * -1 or 0 if unknown) every period from their own thread: the phases of a CDCL
+ * solver given by the channel source at its import points, the best
+ * assignment of a local searcher after a run with its unsat count.
+ * aggregate() merges the fresh contributions into a hint, by majority vote or
+ * by taking the contribution with the least unsat count (policy BEST,
+ * majority if no contribution has an unsat count).
+ * The subscribers poll the hint version at their own points and set it as
+ * their phases.
+ *
+ * Publishing and aggregation are rare (once per period) and run under a
+ * mutex; a poll without new hint is a single atomic load.
+ * @ingroup sharing
+ */
+class PhaseChannel
+{
+public:
+  /// How the contributions are merged
+  enum class Policy
+  {
+    MAJORITY,
+    BEST,
+  };
+
+  /// Phases the CDCL contributors publish
+  enum class Source
+  {
+    BEST,   ///< best phases (largest trail since the last rephase)
+    TARGET, ///< target phases (largest conflict-free trail)
+    SAVED,  ///< saved phases (last value of each variable)
+  };
+
+  /// Unsat count of the contributions that do not have one (CDCL phases)
+  static constexpr unsigned NO_UNSAT_COUNT = UINT_MAX;
+
+  using Phases = std::vector<signed char>;
+
+  PhaseChannel() = default;
+  PhaseChannel(const PhaseChannel&) = delete;
+  PhaseChannel& operator=(const PhaseChannel&) = delete;
+
+  /**
+   * @brief Register a contributor.
+   * @return its slot, to be given to publish
+   */
+  int join();
+
+  /**
+   * @brief Replace the contribution of slot.
+   * @param phases phase of each variable (index 0 unused)
+   * @param unsatCount clauses falsified by the phases, NO_UNSAT_COUNT if not
+   * measured
+   */
+  void publish(int slot, const Phases& phases, unsigned unsatCount);
+
+  /**
+   * @brief Merge the contributions published since the previous call into a
+   * new hint.
+   * @return the number of contributions merged (no new hint if 0)
+   */
+  unsigned aggregate();
+
+  /**
+   * @brief The current hint if it changed since cursor.
+   * @param cursor version of the last hint read by the caller, updated
+   * @return nullptr if there is no new hint
+   */
+  std::shared_ptr<const Phases> poll(uint64_t& cursor) const;
+
+  /// @warning To be set before solving
+  void setPolicy(Policy policy) { m_policy = policy; }
+
+  Source getSource() const { return m_source; }
+
+  /// @warning To be set before solving
+  void setSource(Source source) { m_source = source; }
+
+  /// Period between two publications of a contributor
+  std::chrono::microseconds getPeriod() const { return m_period; }
+
+  /// @warning To be set before solving
+  void setPeriod(std::chrono::microseconds period) { m_period = period; }
+
+private:
+  struct Contribution
+  {
+    Phases phases;
+    unsigned unsatCount = NO_UNSAT_COUNT;
+
+    /// Published since the last aggregate
+    bool fresh = false;
+  };
+
+  Policy m_policy = Policy::MAJORITY;
+  Source m_source = Source::BEST;
+  std::chrono::microseconds m_period{ 1'000'000 };
+
+  /// Contributions and current hint
+  mutable std::mutex m_mutex;
+  std::vector<Contribution> m_contributions;
+  std::shared_ptr<const Phases> m_hint;
+
+  /// Incremented at each new hint
+  std::atomic<uint64_t> m_version{ 0 };
+
+  /// Sum of the votes per variable (reused buffer)
+  std::vector<int> m_votes;
+};
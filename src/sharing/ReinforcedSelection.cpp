@@ -0,0 +1,66 @@
+#include "sharing/ReinforcedSelection.hpp"
+
+#include <algorithm>
+#include <climits>
+
+ReinforcedSelection::Counts
+ReinforcedSelection::select(ClauseDatabase& db,
+                            std::vector<ClauseExchangePtr>& selection,
+                            unsigned literalCountLimit)
+{
+  Counts counts;
+
+  const unsigned window = literalCountLimit > UINT_MAX / WINDOW_FACTOR
+                            ? UINT_MAX
+                            : literalCountLimit * WINDOW_FACTOR;
+  db.giveSelection(m_arrivals, window);
+  for (ClauseExchangePtr& clause : m_arrivals) {
+    auto [it, inserted] = m_index.try_emplace(clause, m_entries.size());
+    if (inserted) {
+      const int from = clause->from;
+      m_entries.push_back({ std::move(clause), { from } });
+      continue;
+    }
+
+    Entry& entry = m_entries[it->second];
+    counts.mergedArrivals++;
+    if (std::find(entry.producers.begin(),
+                  entry.producers.end(),
+                  clause->from) == entry.producers.end())
+      entry.producers.push_back(clause->from);
+    if (clause->lbd < entry.clause->lbd)
+      entry.clause = std::move(clause);
+  }
+  m_arrivals.clear();
+  m_index.clear();
+
+  std::stable_sort(m_entries.begin(),
+                   m_entries.end(),
+                   [](const Entry& a, const Entry& b) {
+                     const bool shortA = a.clause->size <= 2;
+                     if (shortA != (b.clause->size <= 2))
+                       return shortA;
+                     if (shortA && a.clause->size != b.clause->size)
+                       return a.clause->size < b.clause->size;
+                     if (a.producers.size() != b.producers.size())
+                       return a.producers.size() > b.producers.size();
+                     if (a.clause->size != b.clause->size)
+                       return a.clause->size < b.clause->size;
+                     return a.clause->lbd < b.clause->lbd;
+                   });
+
+  unsigned used = 0;
+  for (Entry& entry : m_entries) {
+    if (used + entry.clause->size > literalCountLimit) {
+      db.addClause(std::move(entry.clause));
+      continue;
+    }
+    used += entry.clause->size;
+    if (entry.producers.size() > 1)
+      counts.reinforcedClauses++;
+    selection.push_back(std::move(entry.clause));
+  }
+  m_entries.clear();
+
+  return counts;
+}
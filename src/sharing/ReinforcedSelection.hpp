@@ -0,0 +1,75 @@
+#pragma once
+
+#include "containers/ClauseDatabase.hpp"
+#include "containers/ClauseUtils.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Clause selection favoring the clauses learnt by several producers.
+ *
+ * @details A clause learnt independently by several solvers is more likely to
+ * be useful. The database of a local strategy stores every arrival, a
+ * duplicate included. At each round select() takes the smallest clauses of
+ * the database, WINDOW_FACTOR times the literal budget (the database gives
+ * them size bucket by size bucket, the larger ones stay in place), merges the
+ * copies of a clause into one entry counting its distinct producers (keeping
+ * the lowest lbd), and selects within the literal budget: the units and
+ * binaries first, then the other entries by decreasing producer count, size
+ * and lbd. The entries not selected go back to the database, their count
+ * starts over at the next round.
+ *
+ * The merged entry keeps the producer of one of its copies: only that one is
+ * skipped at export.
+ * @ingroup sharing
+ */
+class ReinforcedSelection
+{
+public:
+  /// Counts of the last select call
+  struct Counts
+  {
+    /// Arrivals merged into the entry of an earlier copy
+    unsigned long mergedArrivals = 0;
+
+    /// Selected entries with at least two producers
+    unsigned long reinforcedClauses = 0;
+  };
+
+  /**
+   * @brief Select the clauses of the round from db, see the class details.
+   * @param db the database of the strategy, it keeps the entries not selected
+   * @param selection filled with the selected clauses, best first
+   * @param literalCountLimit literals of the selection
+   * @return the counts of this round
+   * @note Only called by the sharer thread of the strategy.
+   */
+  Counts select(ClauseDatabase& db,
+                std::vector<ClauseExchangePtr>& selection,
+                unsigned literalCountLimit);
+
+private:
+  /// Literals taken from the database per literal of the budget
+  static constexpr unsigned WINDOW_FACTOR = 4;
+
+  /// A clause of the round and its distinct producers
+  struct Entry
+  {
+    ClauseExchangePtr clause;
+    std::vector<int> producers;
+  };
+
+  /// Arrivals taken from the database this round (reused buffer)
+  std::vector<ClauseExchangePtr> m_arrivals;
+
+  /// Merged arrivals (reused buffer)
+  std::vector<Entry> m_entries;
+
+  /// Position in m_entries of each clause
+  std::unordered_map<ClauseExchangePtr,
+                     size_t,
+                     ClauseUtils::ClauseExchangePtrHash,
+                     ClauseUtils::ClauseExchangePtrEqual>
+    m_index;
+};
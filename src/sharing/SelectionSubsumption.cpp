@@ -0,0 +1,209 @@
+#include "sharing/SelectionSubsumption.hpp"
+
+#include <algorithm>
+
+SelectionSubsumption::SelectionSubsumption(std::chrono::microseconds budget,
+                                           size_t maxBinaries)
+  : m_budget(budget)
+  , m_maxBinaries(maxBinaries)
+{
+}
+
+void
+SelectionSubsumption::reserve(const ClauseExchange& clause)
+{
+  lit_t maxVar = 0;
+  for (lit_t lit : clause)
+    maxVar = std::max(maxVar, std::abs(lit));
+  const size_t nodes = 2 * static_cast<size_t>(maxVar) + 2;
+  if (m_marks.size() >= nodes)
+    return;
+  m_values.resize(maxVar + 1, 0);
+  m_partners.resize(nodes);
+  m_occurrences.resize(nodes);
+  m_marks.resize(nodes, 0);
+}
+
+bool
+SelectionSubsumption::addBinary(lit_t first, lit_t second)
+{
+  if (first == -second || m_binaryKeys.size() >= m_maxBinaries)
+    return false;
+
+  const uint32_t a = std::min(node(first), node(second));
+  const uint32_t b = std::max(node(first), node(second));
+  if (!m_binaryKeys.insert(static_cast<uint64_t>(a) << 32 | b).second)
+    return false;
+
+  m_partners[node(first)].push_back(second);
+  m_partners[node(second)].push_back(first);
+  return true;
+}
+
+bool
+SelectionSubsumption::subsumed(const std::vector<lit_t>& lits,
+                               uint64_t signature) const
+{
+  const uint64_t outside = ~signature;
+  for (lit_t lit : lits) {
+    const uint32_t n = node(lit);
+
+    for (lit_t partner : m_partners[n])
+      if (m_marks[node(partner)] == m_stamp)
+        return true;
+
+    // Per block, a branch free pass over the signatures flags the candidates,
+    // the flagged clauses are then compared literal by literal. The test is
+    // folded to 32 bits: SSE2 has no 64-bit compare, the pass is vectorized
+    // on the baseline x86-64 target
+    const Occurrences& occurrences = m_occurrences[n];
+    const uint64_t* signatures = occurrences.signatures.data();
+    const size_t count = occurrences.signatures.size();
+    uint8_t candidates[SIGNATURE_BLOCK];
+    for (size_t base = 0; base < count; base += SIGNATURE_BLOCK) {
+      const size_t width = std::min(SIGNATURE_BLOCK, count - base);
+      uint8_t found = 0;
+      for (size_t i = 0; i < width; i++) {
+        const uint64_t extra = signatures[base + i] & outside;
+        candidates[i] = (static_cast<uint32_t>(extra) |
+                         static_cast<uint32_t>(extra >> 32)) == 0;
+        found |= candidates[i];
+      }
+      if (!found)
+        continue;
+      for (size_t i = 0; i < width; i++)
+        if (candidates[i] && contained(occurrences.clauses[base + i]))
+          return true;
+    }
+  }
+  return false;
+}
+
+bool
+SelectionSubsumption::contained(uint32_t clause) const
+{
+  for (uint32_t k = m_starts[clause]; k < m_starts[clause + 1]; k++)
+    if (m_marks[node(m_literals[k])] != m_stamp)
+      return false;
+  return true;
+}
+
+unsigned
+SelectionSubsumption::strengthen(std::vector<lit_t>& lits)
+{
+  unsigned removed = 0;
+  for (size_t i = 0; i < lits.size() && lits.size() > 1;) {
+    const lit_t lit = lits[i];
+    bool resolved = false;
+    for (lit_t partner : m_partners[node(-lit)]) {
+      if (m_marks[node(partner)] == m_stamp) {
+        resolved = true;
+        break;
+      }
+    }
+    if (!resolved) {
+      i++;
+      continue;
+    }
+    m_marks[node(lit)] = 0;
+    lits.erase(lits.begin() + i);
+    removed++;
+  }
+  return removed;
+}
+
+SelectionSubsumption::Counts
+SelectionSubsumption::simplify(std::vector<ClauseExchangePtr>& selection)
+{
+  Counts counts;
+  const auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t n : m_listedNodes) {
+    m_occurrences[n].signatures.clear();
+    m_occurrences[n].clauses.clear();
+  }
+  m_listedNodes.clear();
+  m_literals.clear();
+  m_starts.assign(1, 0);
+
+  m_order.resize(selection.size());
+  for (uint32_t i = 0; i < m_order.size(); i++)
+    m_order[i] = i;
+  std::stable_sort(m_order.begin(), m_order.end(), [&](uint32_t a, uint32_t b) {
+    return selection[a]->size < selection[b]->size;
+  });
+
+  for (size_t k = 0; k < m_order.size(); k++) {
+    if (k % 64 == 0 && k &&
+        std::chrono::steady_clock::now() - start > m_budget) {
+      counts.interrupted = true;
+      break;
+    }
+
+    ClauseExchangePtr& clause = selection[m_order[k]];
+    reserve(*clause);
+
+    // Recorded units: satisfied clause or falsified literals
+    bool satisfied = false;
+    m_current.clear();
+    for (lit_t lit : *clause) {
+      const int val = value(lit);
+      satisfied |= val > 0;
+      if (!val)
+        m_current.push_back(lit);
+    }
+    if (satisfied) {
+      counts.subsumedClauses++;
+      clause = nullptr;
+      continue;
+    }
+    // All falsified: kept as is for the solvers to conclude
+    if (m_current.empty())
+      continue;
+
+    if (!++m_stamp) {
+      std::fill(m_marks.begin(), m_marks.end(), 0);
+      m_stamp = 1;
+    }
+    uint64_t signature = 0;
+    for (lit_t lit : m_current) {
+      m_marks[node(lit)] = m_stamp;
+      signature |= signatureBit(lit);
+    }
+    if (subsumed(m_current, signature)) {
+      counts.subsumedClauses++;
+      clause = nullptr;
+      continue;
+    }
+
+    strengthen(m_current);
+    if (m_current.size() < clause->size) {
+      counts.strengthenedLiterals += clause->size - m_current.size();
+      const lbd_t lbd = std::min<lbd_t>(clause->lbd, m_current.size());
+      clause = ClauseExchange::create(m_current, lbd, clause->from);
+    }
+
+    if (m_current.size() == 1) {
+      m_values[std::abs(m_current[0])] = m_current[0] > 0 ? 1 : -1;
+      continue;
+    }
+    if (m_current.size() == 2 && addBinary(m_current[0], m_current[1]))
+      continue;
+
+    // Listed under its first literal for the larger clauses of the round
+    signature = 0;
+    for (lit_t lit : m_current)
+      signature |= signatureBit(lit);
+    Occurrences& occurrences = m_occurrences[node(m_current[0])];
+    if (occurrences.clauses.empty())
+      m_listedNodes.push_back(node(m_current[0]));
+    occurrences.signatures.push_back(signature);
+    occurrences.clauses.push_back(m_starts.size() - 1);
+    m_literals.insert(m_literals.end(), m_current.begin(), m_current.end());
+    m_starts.push_back(m_literals.size());
+  }
+
+  selection.erase(std::remove(selection.begin(), selection.end(), nullptr),
+                  selection.end());
+  return counts;
+}
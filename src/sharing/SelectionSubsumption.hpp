@@ -0,0 +1,140 @@
+#pragma once
+
+#include "containers/ClauseExchange.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Forward subsumption and strengthening of the selection of a round.
+ *
+ * @details Run on the selection before its export, in size order:
+ * - the units and binaries are recorded, a unit or binary already recorded
+ *   (this round or a previous one) is dropped;
+ * - a clause with a recorded true literal is dropped as subsumed, its
+ *   literals of recorded false value are removed;
+ * - a clause containing a recorded binary is dropped as subsumed, a literal l
+ *   of a clause is removed when a recorded binary (¬l ∨ m) has m in the
+ *   clause (self-subsuming resolution);
+ * - a clause containing a smaller clause of the selection is dropped.
+ *
+ * The candidate subsuming clauses are filtered by their 64-bit literal
+ * signatures: each occurrence list stores the signatures contiguously, the
+ * filter is a branch free word-wise test over blocks of that array (it is
+ * vectorized), only the clauses passing it are compared literal by literal.
+ *
+ * The pass stops at the time budget, the clauses not reached are left as
+ * they are. The selection keeps its order, a strengthened clause replaces the
+ * original one (a copy, the original being shared with the other clients of
+ * its producer).
+ * @ingroup sharing
+ */
+class SelectionSubsumption
+{
+public:
+  /// Counts of the last simplify call
+  struct Counts
+  {
+    /// Clauses dropped as subsumed
+    unsigned long subsumedClauses = 0;
+
+    /// Literals removed from the kept clauses
+    unsigned long strengthenedLiterals = 0;
+
+    /// The budget ran out before the end of the selection
+    bool interrupted = false;
+  };
+
+  /**
+   * @param budget time of one simplify call
+   * @param maxBinaries binaries recorded across the rounds, the following
+   * ones are only used in their round
+   */
+  SelectionSubsumption(std::chrono::microseconds budget,
+                       size_t maxBinaries = 1 << 20);
+
+  /**
+   * @brief Simplify the selection of a round, see the class details.
+   * @param selection the selection, best clauses first
+   * @return the counts of this round
+   * @note Only called by the sharer thread of the strategy.
+   */
+  Counts simplify(std::vector<ClauseExchangePtr>& selection);
+
+private:
+  /// Node of a literal, its negation is node ^ 1
+  static uint32_t node(lit_t lit)
+  {
+    return 2 * static_cast<uint32_t>(std::abs(lit)) + (lit < 0);
+  }
+
+  /// Bit of a literal in the signatures
+  static uint64_t signatureBit(lit_t lit)
+  {
+    return uint64_t(1) << (node(lit) * 0x9E3779B1u >> 26);
+  }
+
+  /// Make room for the nodes of clause
+  void reserve(const ClauseExchange& clause);
+
+  /// Value of a literal from the recorded units: 1 true, -1 false, 0 unknown
+  int value(lit_t lit) const
+  {
+    const size_t var = std::abs(lit);
+    if (var >= m_values.size() || !m_values[var])
+      return 0;
+    return lit < 0 ? -m_values[var] : m_values[var];
+  }
+
+  /// Record a binary, false if it was known
+  bool addBinary(lit_t first, lit_t second);
+
+  /// True if a recorded binary or a smaller clause of the selection is in the
+  /// marked clause
+  bool subsumed(const std::vector<lit_t>& lits, uint64_t signature) const;
+
+  /// True if every literal of the listed clause is marked
+  bool contained(uint32_t clause) const;
+
+  /// Signatures filtered per pass of subsumed
+  static constexpr size_t SIGNATURE_BLOCK = 64;
+
+  /// The recorded binaries (¬lit ∨ m) with m marked remove lit from lits
+  unsigned strengthen(std::vector<lit_t>& lits);
+
+  std::chrono::microseconds m_budget;
+  size_t m_maxBinaries;
+
+  /// Recorded units: value of each variable (1, -1, 0 unknown)
+  std::vector<int8_t> m_values;
+
+  /// Recorded binaries: keys and partner literals of each node
+  std::unordered_set<uint64_t> m_binaryKeys;
+  std::vector<std::vector<lit_t>> m_partners;
+
+  /// Occurrence lists of the clauses of the round not recorded as unit or
+  /// binary, each one is listed under its first literal
+  struct Occurrences
+  {
+    std::vector<uint64_t> signatures;
+    std::vector<uint32_t> clauses;
+  };
+  std::vector<Occurrences> m_occurrences;
+  std::vector<uint32_t> m_listedNodes;
+
+  /// Literals of the listed clauses, clause i in
+  /// m_literals[m_starts[i]..m_starts[i + 1]]
+  std::vector<lit_t> m_literals;
+  std::vector<uint32_t> m_starts;
+
+  /// Marks of the literals of the current clause
+  std::vector<uint32_t> m_marks;
+  uint32_t m_stamp = 0;
+
+  /// Processing order and literals of the current clause (reused buffers)
+  std::vector<uint32_t> m_order;
+  std::vector<lit_t> m_current;
+};
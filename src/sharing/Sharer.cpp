@@ -2,6 +2,7 @@
 #include "utils/Logger.hpp"
 #include "utils/NumericConstants.hpp"
 #include "utils/System.hpp"
+#include "utils/Threading.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -21,6 +22,7 @@ mainThrSharing(void* arg)
   shr->m_round = 0;
   int nbStrats = shr->m_sharingStrategies.size();
   int lastStrategy = -1;
+  int nextStrategy = 0;
 
   std::chrono::microseconds sleepTime, sharingTime(0);
 
@@ -36,7 +38,10 @@ mainThrSharing(void* arg)
       shr->m_manager.waitOnSolving();
     }
 
-    lastStrategy = shr->m_round % nbStrats;
+    lastStrategy = nextStrategy;
+
+    // New round: what is pending in the strategy is about to be shared
+    shr->recordWait(shr->m_notifier->reset(lastStrategy));
 
     // Sharing phase
     sharingTime = SystemResourceMonitor::Timer::getAbsoluteTimeMicro();
@@ -53,9 +58,34 @@ mainThrSharing(void* arg)
          sharingTime.count(),
          sleepTime.count());
 
-    if (!shr->m_manager.shouldEndSolving()) {
+    // Round-robin over the strategies, unless one of them woke the sharer
+    nextStrategy = (lastStrategy + 1) % nbStrats;
+
+    if (!shr->m_manager.shouldEndSolving() && shr->m_notifier->enabled()) {
+      SharingNotifier::Reason reason = shr->m_notifier->waitFor(sleepTime);
+      if (reason == SharingNotifier::Reason::VOLUME ||
+          reason == SharingNotifier::Reason::SHORT_CLAUSE) {
+        int triggered = shr->m_notifier->triggeredSource(nextStrategy);
+        if (triggered >= 0)
+          nextStrategy = triggered;
+      }
+      switch (reason) {
+        case SharingNotifier::Reason::VOLUME:
+          shr->m_volumeRounds++;
+          break;
+        case SharingNotifier::Reason::SHORT_CLAUSE:
+          shr->m_shortClauseRounds++;
+          break;
+        case SharingNotifier::Reason::TIMEOUT:
+          shr->m_timeoutRounds++;
+          break;
+        default:
+          break;
+      }
+    } else if (!shr->m_manager.shouldEndSolving()) {
       UNIQUE_LOCK(std::mutex, shr->m_sharerMX, sleep);
       shr->m_sharerCV.wait_for(lsleep, sleepTime);
+      shr->m_timeoutRounds++;
       LOGD1("Sharer %d shouldTerminate = %d",
             shr->getId(),
             static_cast<int>(shr->shouldTerminate));
@@ -77,6 +107,7 @@ Sharer::Sharer(
   , m_sharingStrategies(_sharingStrategies)
   , m_totalSharingTime(0)
 {
+  initNotifier();
   m_thread = std::thread(mainThrSharing, this);
 }
 
@@ -88,10 +119,70 @@ Sharer::Sharer(PainlessImpl& manager,
   , shouldTerminate(false)
 {
   m_sharingStrategies.push_back(_sharingStrategy);
+  initNotifier();
   m_thread = std::thread(mainThrSharing, this);
 }
 
-Sharer::~Sharer() {}
+Sharer::Sharer(
+  PainlessImpl& manager,
+  int _id,
+  std::vector<std::shared_ptr<SharingStrategy>>& _sharingStrategies,
+  std::nullptr_t)
+  : m_manager(manager)
+  , m_sharerId(_id)
+  , shouldTerminate(false)
+  , m_sharingStrategies(_sharingStrategies)
+  , m_totalSharingTime(0)
+  , m_round(0)
+{
+  initNotifier();
+}
+
+Sharer::~Sharer()
+{
+  // Strategies and their clients reference each other
+  for (auto& strategy : m_sharingStrategies)
+    strategy->clearClients();
+}
+
+void
+Sharer::initNotifier()
+{
+  m_notifier =
+    std::make_shared<SharingNotifier>(m_manager.parameters().sharingWakeVolume,
+                                      m_manager.parameters().sharingWakeSize,
+                                      m_sharingStrategies.size());
+  for (unsigned i = 0; i < m_sharingStrategies.size(); i++)
+    m_sharingStrategies[i]->setNotifier(m_notifier, i);
+}
+
+void
+Sharer::recordWait(const SharingNotifier::Pending& pending)
+{
+  if (!pending.clauses)
+    return;
+
+  m_waitedClauses += pending.clauses;
+  m_totalClauseWait += pending.totalWait;
+
+  m_latencyCount++;
+  if (m_latencies.size() < LATENCY_SAMPLES) {
+    m_latencies.push_back(pending.oldestWait.count());
+  } else {
+    uint64_t slot = m_latencyRng() % m_latencyCount;
+    if (slot < LATENCY_SAMPLES)
+      m_latencies[slot] = pending.oldestWait.count();
+  }
+}
+
+double
+Sharer::getMeanClauseWait() const
+{
+  if (!m_waitedClauses)
+    return 0;
+  return static_cast<double>(m_totalClauseWait.count()) / m_waitedClauses /
+         1000;
+}
 
 void
 Sharer::join()
@@ -99,12 +190,20 @@ Sharer::join()
   UNIQUE_LOCK(std::mutex, m_sharerMX, wake);
   m_sharerCV.notify_one();
   lwake.unlock();
+  m_notifier->notify();
   if (m_thread.joinable()) {
     m_thread.join();
     LOGD1("Sharer %d joined", this->getId());
   }
 }
 
+bool
+Sharer::setCpuAffinity(const std::vector<int>& cpus)
+{
+  return m_thread.joinable() &&
+         setThreadAffinity(m_thread.native_handle(), cpus);
+}
+
 void
 Sharer::printStats()
 {
@@ -115,9 +214,26 @@ Sharer::printStats()
           sharingTimeSec,
           this->m_round,
           sharingTimeSec / this->m_round);
+
+  double medianOldestWait = 0;
+  if (!m_latencies.empty()) {
+    auto middle = m_latencies.begin() + m_latencies.size() / 2;
+    std::nth_element(m_latencies.begin(), middle, m_latencies.end());
+    medianOldestWait = static_cast<double>(*middle) / 1000;
+  }
+  LOGSTAT("Sharer %d: rounds woken by volume: %u, by short clause: %u, by "
+          "timeout: %u, mean clause wait: %lf ms, median wait of the oldest "
+          "pending clause: %lf ms",
+          this->getId(),
+          m_volumeRounds,
+          m_shortClauseRounds,
+          m_timeoutRounds,
+          getMeanClauseWait(),
+          medianOldestWait);
   for (unsigned int i = 0; i < m_sharingStrategies.size(); i++) {
-    LOGSTAT("Strategy '%s': %s",
+    LOGSTAT("Strategy '%s': %s%s",
             typeid(*m_sharingStrategies[i]).name(),
-            m_sharingStrategies[i]->getStatistics().toString().c_str());
+            m_sharingStrategies[i]->getStatistics().toString().c_str(),
+            m_sharingStrategies[i]->budgetsToString().c_str());
   }
 }
\ No newline at end of file
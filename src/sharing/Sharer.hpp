@@ -1,10 +1,12 @@
 #pragma once
 
 #include "sharing/SharingEntity.hpp"
+#include "sharing/SharingNotifier.hpp"
 #include "sharing/SharingStrategy.hpp"
 #include "utils/Logger.hpp"
 #include <condition_variable>
 #include <mutex>
+#include <random>
 #include <thread>
 
 class PainlessImpl;
@@ -65,11 +67,33 @@ public:
    */
   inline void setId(plid_t id) { this->m_sharerId = id; }
 
-  void join();
+  virtual void join();
+
+  /// Strategies run by this sharer
+  const std::vector<std::shared_ptr<SharingStrategy>>& getSharingStrategies()
+    const
+  {
+    return m_sharingStrategies;
+  }
 
   inline void asyncTerminate() { shouldTerminate = true; }
 
+  /**
+   * @brief Restrict the sharing thread(s) to cpus.
+   * @return false if a thread could not be pinned
+   */
+  virtual bool setCpuAffinity(const std::vector<int>& cpus);
+
 protected:
+  /**
+   * @brief Constructor for subclasses running the strategies on their own
+   * threads: no sharing thread is started.
+   */
+  Sharer(PainlessImpl& manager,
+         int id_,
+         std::vector<std::shared_ptr<SharingStrategy>>& sharingStrategies,
+         std::nullptr_t);
+
   /**
    * @brief Working function that will call sharingStrategy doSharing()
    * @param  sharer the sharer object
@@ -77,6 +101,22 @@ protected:
    */
   friend void* mainThrSharing(void*);
 
+  /**
+   * @brief Create the notifier from the parameters and give it to the
+   * strategies, must be done before starting the thread.
+   */
+  void initNotifier();
+
+  /**
+   * @brief Account for the clauses pending in a strategy at the start of its
+   * round: their waits are summed (mean clause wait) and the wait of the
+   * oldest one is sampled (reservoir of LATENCY_SAMPLES values).
+   */
+  void recordWait(const SharingNotifier::Pending& pending);
+
+  /// Mean time (ms) between the import of a clause and its round
+  double getMeanClauseWait() const;
+
   /// Bool to notify the sharer to terminate
   std::atomic<bool> shouldTerminate;
 
@@ -95,6 +135,24 @@ protected:
   /// Number of sharing rounds completed.
   uint m_round;
 
+  /// Wakes this sharer when one of its strategies has enough pending clauses
+  std::shared_ptr<SharingNotifier> m_notifier;
+
+  /// Rounds started by each kind of wake up
+  uint m_volumeRounds = 0;
+  uint m_shortClauseRounds = 0;
+  uint m_timeoutRounds = 0;
+
+  /// Clauses taken by the rounds and the sum of their waits
+  uint64_t m_waitedClauses = 0;
+  std::chrono::microseconds m_totalClauseWait{ 0 };
+
+  /// Sampled waiting time of the oldest clause of each round (us)
+  static constexpr size_t LATENCY_SAMPLES = 1 << 16;
+  std::vector<uint64_t> m_latencies;
+  uint64_t m_latencyCount = 0;
+  std::minstd_rand m_latencyRng;
+
   /// Strategy/Strategies used to share clauses.
   std::vector<std::shared_ptr<SharingStrategy>> m_sharingStrategies;
 
@@ -1,12 +1,19 @@
 #pragma once
 
 #include "containers/ClauseExchange.hpp"
+#include "sharing/Filters/RejectedLiterals.hpp"
 #include "utils/Logger.hpp"
 #include "utils/Mutex.hpp"
 
 #include <atomic>
+#include <climits>
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
+#include <thread>
+#include <vector>
 
 /**
  * @defgroup sharing Sharing
@@ -22,17 +29,27 @@
  * @details This class defines how an object can share clauses.There are two
  * virtual methods: importClause, exportClauseToClient. exportClauseClient has a
  * default implementation that calls the importClause of the client. However,
- * importClause must be defined by subclasses. The non virtual export methods
- * locks on the client list since clients can be added dynamically. The client
- * list holds weak_ptr to the other SharingEntities, since it only reference
- * them and shouldn't retain a SharingEntity from being destroyed.
+ * importClause must be defined by subclasses.
+ *
+ * The client list is read on every exported clause but almost never changes
+ * after the configuration, it is thus published RCU style: an immutable
+ * snapshot of strong pointers swapped atomically. The export methods read it
+ * through a ClientsGuard: they count themselves in the reader counter of the
+ * current epoch, then load the snapshot. addClient/removeClient copy the list
+ * under a mutex, publish the copy, flip the epoch and wait for the readers of
+ * the previous epoch to leave (a grace period) before releasing the replaced
+ * snapshot, and with it the clients only it held. The new readers count
+ * themselves in the other counter, so the wait ends once the running exports
+ * are done.
  *
  * @warning This class assumes all SharingEntity objects are managed by
  * std::shared_ptr. Improper use of raw pointers or other smart pointer types
  * may lead to undefined behavior.
+ * @warning Clients are strong references: entities that are clients of each
+ * other (e.g. a solver and its strategy) are only released once clearClients
+ * breaks the cycle.
  *
- * @todo Test userspace RCU for m_clients list. Copy and move
- * constructors/operators
+ * @todo Copy and move constructors/operators
  */
 class SharingEntity : public std::enable_shared_from_this<SharingEntity>
 {
@@ -47,8 +64,8 @@ public:
    */
   SharingEntity()
     : m_sharingId(s_currentSharingId.fetch_add(1))
-    , m_clients(0)
   {
+    publishClients(ClientList());
   }
 
   /**
@@ -61,8 +78,8 @@ public:
    */
   SharingEntity(const std::vector<std::shared_ptr<SharingEntity>>& clients)
     : m_sharingId(s_currentSharingId.fetch_add(1))
-    , m_clients(clients.begin(), clients.end())
   {
+    publishClients(ClientList(clients));
   }
 
   /**
@@ -80,6 +97,50 @@ public:
    */
   virtual bool importClause(const ClauseExchangePtr& clause) = 0;
 
+  /// Bounds on the clauses an entity may accept (inclusive)
+  struct ImportLimits
+  {
+    unsigned size = UINT_MAX;
+    unsigned lbd = UINT_MAX;
+  };
+
+  /**
+   * @brief Advertise the largest size and lbd importClause may accept from a
+   * producer, the producers drop the other clauses before creating them.
+   * @param producer sharing id of the producer
+   * @return no bound by default
+   * @note Called concurrently by the producers, it must be cheap.
+   */
+  virtual ImportLimits getImportLimits(int producer) const { return {}; }
+
+  /**
+   * @brief Usefulness feedback: a clause produced by producer and imported by
+   * a client of this entity took part in a conflict analysis of the client.
+   * @param producer sharing id of the producer (ClauseExchange::from)
+   * @note Called concurrently by the consuming solvers, ignored by default.
+   */
+  virtual void notifyClauseUsed(int producer) {}
+
+  /**
+   * @brief Clauses this entity accepted but did not consume yet (its import
+   * database), read by the strategies bounding what they send it.
+   * @return std::nullopt if the entity does not measure it
+   * @note Called by the sharer threads, it must be cheap.
+   */
+  virtual std::optional<size_t> getImportBacklog() const
+  {
+    return std::nullopt;
+  }
+
+  /**
+   * @brief Literals whose clauses importClause would drop.
+   * @return nullptr if the entity does not advertise them
+   */
+  const RejectedLiterals* getRejectedLiterals() const
+  {
+    return m_rejectedLiterals.load(std::memory_order_acquire);
+  }
+
   /**
    * @brief Add a client to this entity.
    * @param client shared pointer to the client SharingEntity to add.
@@ -88,12 +149,14 @@ public:
    */
   void addClient(std::shared_ptr<SharingEntity> client)
   {
-    UNIQUE_LOCK(std::shared_mutex, m_clientsMutex, lock);
+    LOCK_GUARD(std::mutex, m_clientsMutex, lock);
     LOGD4("Sharing Entity %d: new client %p (counts: %d)",
           m_sharingId,
           client.get(),
           client.use_count());
-    m_clients.push_back(client);
+    ClientList clients(*m_clients.load(std::memory_order_relaxed));
+    clients.push_back(std::move(client));
+    publishClients(std::move(clients));
   }
 
   /**
@@ -104,17 +167,14 @@ public:
    */
   void removeClient(std::shared_ptr<SharingEntity> client)
   {
-    UNIQUE_LOCK(std::shared_mutex, m_clientsMutex, lock);
-    auto initialSize = m_clients.size();
-    m_clients.erase(
-      std::remove_if(m_clients.begin(),
-                     m_clients.end(),
-                     [&client](const std::weak_ptr<SharingEntity>& wp) {
-                       return wp.lock() == client;
-                     }),
-      m_clients.end());
-    if (m_clients.size() < initialSize) {
+    LOCK_GUARD(std::mutex, m_clientsMutex, lock);
+    ClientList clients(*m_clients.load(std::memory_order_relaxed));
+    auto initialSize = clients.size();
+    clients.erase(std::remove(clients.begin(), clients.end(), client),
+                  clients.end());
+    if (clients.size() < initialSize) {
       LOGD4("Sharing Entity %d: removed client %p", m_sharingId, client.get());
+      publishClients(std::move(clients));
     }
   }
 
@@ -135,22 +195,19 @@ public:
    * @return The number of clients currently registered with this entity.
    *
    * This method is thread-safe and can be called concurrently.
-   * Note: This count includes expired weak pointers that haven't been cleaned
-   * up yet.
    */
   size_t getClientCount() const
   {
-    SHARED_LOCK(std::shared_mutex, m_clientsMutex, lock);
-    return m_clients.size();
+    return ClientsGuard(*this)->size();
   }
 
   /**
-   * @brief Remove all clients.
+   * @brief Remove all clients, once the running exports are done.
    */
   void clearClients()
   {
-    UNIQUE_LOCK(std::shared_mutex, m_clientsMutex, lock);
-    m_clients.clear();
+    LOCK_GUARD(std::mutex, m_clientsMutex, lock);
+    publishClients(ClientList());
   }
 
 protected:
@@ -183,17 +240,32 @@ protected:
    */
   bool exportClause(const ClauseExchangePtr& clause)
   {
-    SHARED_LOCK(std::shared_mutex, m_clientsMutex, lock);
     bool exported = false;
-    for (const std::weak_ptr<SharingEntity>& client : m_clients) {
-      if (std::shared_ptr<SharingEntity> sharedClient = client.lock()) {
-        if (exportClauseToClient(clause, sharedClient))
-          exported = true;
-      }
+    const ClientsGuard clients(*this);
+    for (const std::shared_ptr<SharingEntity>& client : *clients) {
+      if (!rejectedBy(*client, clause) && exportClauseToClient(clause, client))
+        exported = true;
     }
     return exported;
   }
 
+  /**
+   * @brief Bounds covering what any client may accept from this entity.
+   * @return the largest size and lbd limits advertised by the clients (a
+   * clause beyond them would be rejected by all of them)
+   */
+  ImportLimits getClientsImportLimits() const
+  {
+    const ClientsGuard clients(*this);
+    ImportLimits limits{ 0, 0 };
+    for (const auto& client : *clients) {
+      ImportLimits clientLimits = client->getImportLimits(m_sharingId);
+      limits.size = std::max(limits.size, clientLimits.size);
+      limits.lbd = std::max(limits.lbd, clientLimits.lbd);
+    }
+    return clients->empty() ? ImportLimits() : limits;
+  }
+
   /**
    * @brief Export multiple clauses to all registered clients.
    * @param clauses A vector of clauses to export.
@@ -204,24 +276,137 @@ protected:
    */
   void exportClauses(const std::vector<ClauseExchangePtr>& clauses)
   {
-    SHARED_LOCK(std::shared_mutex, m_clientsMutex, lock);
-    for (const auto& weakClient : m_clients) {
-      if (auto client = weakClient.lock()) {
-        for (const ClauseExchangePtr& clause : clauses) {
+    const ClientsGuard clients(*this);
+    for (const auto& client : *clients) {
+      for (const ClauseExchangePtr& clause : clauses) {
+        if (!rejectedBy(*client, clause))
           exportClauseToClient(clause, client);
-        }
       }
     }
   }
 
-protected:
-  /// List of weak pointers to client SharingEntities.
-  std::vector<std::weak_ptr<SharingEntity>> m_clients;
+  using ClientList = std::vector<std::shared_ptr<SharingEntity>>;
+
+  /**
+   * @brief Read access to the current snapshot of the clients, which is not
+   * released while the guard lives.
+   * @warning A guard must not be held across a change of the clients of the
+   * same entity by the same thread (the change would wait for it).
+   */
+  class ClientsGuard
+  {
+  public:
+    explicit ClientsGuard(const SharingEntity& entity)
+    {
+      // Counted in the epoch still current once counted, else a writer may
+      // already be waiting for the other counter
+      unsigned epoch = entity.m_epoch.load(std::memory_order_seq_cst);
+      while (true) {
+        m_readers = &entity.m_readers[epoch & 1];
+        m_readers->fetch_add(1, std::memory_order_seq_cst);
+        const unsigned current = entity.m_epoch.load(std::memory_order_seq_cst);
+        if (current == epoch)
+          break;
+        m_readers->fetch_sub(1, std::memory_order_release);
+        epoch = current;
+      }
+      m_clients = entity.m_clients.load(std::memory_order_seq_cst);
+    }
 
-  /// Mutex to protect access to m_clients
-  mutable std::shared_mutex m_clientsMutex;
+    ~ClientsGuard() { m_readers->fetch_sub(1, std::memory_order_release); }
+
+    ClientsGuard(const ClientsGuard&) = delete;
+    ClientsGuard& operator=(const ClientsGuard&) = delete;
+
+    const ClientList& operator*() const { return *m_clients; }
+    const ClientList* operator->() const { return m_clients; }
+
+  private:
+    std::atomic<unsigned>* m_readers;
+    const ClientList* m_clients;
+  };
+
+  /**
+   * @brief Current snapshot of the clients, for strategies exporting to a
+   * chosen subset of them (see exportClauseTo).
+   */
+  ClientsGuard getClients() const { return ClientsGuard(*this); }
+
+  /**
+   * @brief Export a clause to a single client, as exportClause does for each
+   * of them.
+   * @return true if the clause was exported to the client, false otherwise.
+   */
+  bool exportClauseTo(const ClauseExchangePtr& clause,
+                      const std::shared_ptr<SharingEntity>& client)
+  {
+    return !rejectedBy(*client, clause) && exportClauseToClient(clause, client);
+  }
+
+  /// Forward a usefulness feedback to every client (see notifyClauseUsed)
+  void notifyClientsClauseUsed(int producer)
+  {
+    const ClientsGuard clients(*this);
+    for (const auto& client : *clients)
+      client->notifyClauseUsed(producer);
+  }
+
+  /**
+   * @brief Advertise the literals whose clauses importClause would drop, the
+   * export methods of the producers then skip such clauses for this entity.
+   * @param rejected must outlive the entity, nullptr to stop advertising
+   */
+  void setRejectedLiterals(const RejectedLiterals* rejected)
+  {
+    m_rejectedLiterals.store(rejected, std::memory_order_release);
+  }
 
 private:
+  /// True if client advertises a literal of clause as rejected
+  static bool rejectedBy(const SharingEntity& client,
+                         const ClauseExchangePtr& clause)
+  {
+    const RejectedLiterals* rejected =
+      client.m_rejectedLiterals.load(std::memory_order_acquire);
+    if (!rejected || !rejected->rejects(*clause))
+      return false;
+    rejected->countAvoided();
+    return true;
+  }
+
+  /**
+   * @brief Make clients the current snapshot (m_clientsMutex held or
+   * constructor) and release the replaced one after a grace period.
+   */
+  void publishClients(ClientList&& clients)
+  {
+    auto snapshot = std::make_unique<const ClientList>(std::move(clients));
+    m_clients.store(snapshot.get(), std::memory_order_seq_cst);
+    std::swap(snapshot, m_currentClients);
+    if (!snapshot)
+      return;
+
+    // The readers that may hold the replaced snapshot are all counted in the
+    // counter of the previous epoch
+    const unsigned previous = m_epoch.fetch_add(1, std::memory_order_seq_cst);
+    while (m_readers[previous & 1].load(std::memory_order_acquire))
+      std::this_thread::yield();
+  }
+
+  /// Current snapshot of the clients, never null
+  std::atomic<const ClientList*> m_clients{ nullptr };
+  std::unique_ptr<const ClientList> m_currentClients;
+
+  /// Grace periods: the readers count themselves in m_readers[m_epoch & 1]
+  std::atomic<unsigned> m_epoch{ 0 };
+  mutable std::atomic<unsigned> m_readers[2] = { 0, 0 };
+
+  /// Serializes the writers of m_clients
+  std::mutex m_clientsMutex;
+
+  /// See setRejectedLiterals, nullptr by default
+  std::atomic<const RejectedLiterals*> m_rejectedLiterals{ nullptr };
+
   /// The sharing ID of this entity.
   int m_sharingId;
 
@@ -0,0 +1,264 @@
+#include "sharing/SharingExecutor.hpp"
+#include "utils/Logger.hpp"
+#include "utils/NumericConstants.hpp"
+#include "utils/System.hpp"
+#include "utils/Threading.hpp"
+
+#include <algorithm>
+
+#include "core/painless.hpp"
+
+using namespace std::chrono;
+
+/// Longest wait of an idle worker (all the tasks being run by others)
+static constexpr microseconds IDLE_WAIT(100'000);
+
+SharingExecutor::SharingExecutor(
+  PainlessImpl& manager,
+  int _id,
+  std::vector<std::shared_ptr<SharingStrategy>>& _sharingStrategies,
+  unsigned threadCount)
+  : Sharer(manager, _id, _sharingStrategies, nullptr)
+{
+  PABORTIF(m_sharingStrategies.empty(),
+           PERR_ARGS,
+           "A sharing executor needs at least one strategy");
+
+  threadCount =
+    std::clamp<unsigned>(threadCount, 1, m_sharingStrategies.size());
+
+  microseconds now = SystemResourceMonitor::Timer::getAbsoluteTimeMicro();
+  m_tasks.reserve(m_sharingStrategies.size());
+  for (unsigned i = 0; i < m_sharingStrategies.size(); i++)
+    m_tasks.push_back(Task{ m_sharingStrategies[i], i, now });
+
+  for (unsigned i = 0; i < threadCount; i++)
+    m_queues.push_back(std::make_unique<Queue>());
+  for (size_t i = 0; i < m_tasks.size(); i++)
+    push(*m_queues[i % threadCount], &m_tasks[i]);
+
+  LOG1("Sharing executor %d: %zu strategies on %u threads",
+       this->getId(),
+       m_tasks.size(),
+       threadCount);
+
+  for (unsigned i = 0; i < threadCount; i++)
+    m_workers.emplace_back(&SharingExecutor::workerMain, this, i);
+}
+
+SharingExecutor::~SharingExecutor()
+{
+  asyncTerminate();
+  join();
+}
+
+bool
+SharingExecutor::setCpuAffinity(const std::vector<int>& cpus)
+{
+  bool pinned = true;
+  for (auto& worker : m_workers)
+    pinned &= setThreadAffinity(worker.native_handle(), cpus);
+  return pinned;
+}
+
+void
+SharingExecutor::push(Queue& queue, Task* task)
+{
+  LOCK_GUARD(std::mutex, queue.mutex, push);
+  queue.heap.push_back(task);
+  std::push_heap(queue.heap.begin(), queue.heap.end(), laterDue);
+}
+
+SharingExecutor::Task*
+SharingExecutor::popDue(Queue& queue, microseconds now, bool force)
+{
+  LOCK_GUARD(std::mutex, queue.mutex, pop);
+  if (queue.heap.empty() || (!force && queue.heap.front()->due > now))
+    return nullptr;
+  std::pop_heap(queue.heap.begin(), queue.heap.end(), laterDue);
+  Task* task = queue.heap.back();
+  queue.heap.pop_back();
+  return task;
+}
+
+bool
+SharingExecutor::take(Task* task)
+{
+  for (auto& queue : m_queues) {
+    LOCK_GUARD(std::mutex, queue->mutex, take);
+    auto it = std::find(queue->heap.begin(), queue->heap.end(), task);
+    if (it == queue->heap.end())
+      continue;
+    queue->heap.erase(it);
+    std::make_heap(queue->heap.begin(), queue->heap.end(), laterDue);
+    return true;
+  }
+  return false;
+}
+
+microseconds
+SharingExecutor::earliestDue()
+{
+  microseconds earliest = microseconds::max();
+  for (auto& queue : m_queues) {
+    LOCK_GUARD(std::mutex, queue->mutex, peek);
+    if (!queue->heap.empty())
+      earliest = std::min(earliest, queue->heap.front()->due);
+  }
+  return earliest;
+}
+
+void
+SharingExecutor::run(unsigned worker, Task* task)
+{
+  {
+    LOCK_GUARD(std::mutex, m_sharerMX, stats);
+    recordWait(m_notifier->reset(task->source));
+  }
+
+  microseconds start = SystemResourceMonitor::Timer::getAbsoluteTimeMicro();
+  task->strategy->doSharing();
+  microseconds end = SystemResourceMonitor::Timer::getAbsoluteTimeMicro();
+
+  task->executionTime += end - start;
+  task->runs++;
+  task->due = end + task->strategy->getSleepingTime();
+  m_rounds++;
+
+  LOG2("[Sharer %d] worker %u ran '%s' in %lu us",
+       this->getId(),
+       worker,
+       typeid(*task->strategy).name(),
+       (end - start).count());
+
+  push(*m_queues[worker], task);
+
+  // Triggered while running, the first worker could not take it
+  if (m_notifier->isTriggered(task->source)) {
+    LOCK_GUARD(std::mutex, m_sharerMX, requeued);
+    m_sharerCV.notify_all();
+  }
+}
+
+void
+SharingExecutor::workerMain(unsigned worker)
+{
+  const unsigned queueCount = m_queues.size();
+
+  // To be notified when solver starts solving
+  m_manager.waitOnSolving();
+
+  while (!shouldTerminate) {
+    if (m_manager.shouldEndSolving()) {
+      m_manager.waitOnSolving();
+      continue;
+    }
+
+    microseconds now = SystemResourceMonitor::Timer::getAbsoluteTimeMicro();
+
+    // Own queue first, then steal a due task from the others
+    Task* task = popDue(*m_queues[worker], now, false);
+    for (unsigned i = 1; !task && i < queueCount; i++) {
+      task = popDue(*m_queues[(worker + i) % queueCount], now, false);
+      if (task)
+        task->stolen++;
+    }
+    if (task) {
+      run(worker, task);
+      continue;
+    }
+
+    microseconds sleepTime =
+      std::min(IDLE_WAIT, std::max(microseconds(0), earliestDue() - now));
+
+    // The first worker alone waits on the notifier (it wakes a single waiter)
+    // and runs the strategy that has enough pending clauses. If that strategy
+    // is being run, the worker sleeps until the run ends (see run)
+    if (worker == 0 && m_notifier->enabled()) {
+      SharingNotifier::Reason reason = m_notifier->waitFor(sleepTime);
+      if (reason != SharingNotifier::Reason::VOLUME &&
+          reason != SharingNotifier::Reason::SHORT_CLAUSE)
+        continue;
+      int source = m_notifier->triggeredSource(0);
+      if (source >= 0 && take(&m_tasks[source])) {
+        {
+          LOCK_GUARD(std::mutex, m_sharerMX, stats);
+          if (reason == SharingNotifier::Reason::VOLUME)
+            m_volumeRounds++;
+          else
+            m_shortClauseRounds++;
+        }
+        run(worker, &m_tasks[source]);
+      } else {
+        UNIQUE_LOCK(std::mutex, m_sharerMX, busy);
+        if (!shouldTerminate)
+          m_sharerCV.wait_for(lbusy, sleepTime);
+      }
+    } else {
+      UNIQUE_LOCK(std::mutex, m_sharerMX, sleep);
+      if (!shouldTerminate)
+        m_sharerCV.wait_for(lsleep, sleepTime);
+    }
+  }
+}
+
+void
+SharingExecutor::join()
+{
+  {
+    LOCK_GUARD(std::mutex, m_sharerMX, wake);
+    m_sharerCV.notify_all();
+  }
+  m_notifier->notify();
+
+  if (m_workers.empty())
+    return;
+  for (auto& worker : m_workers)
+    worker.join();
+  m_workers.clear();
+  LOGD1("Sharing executor %d joined", this->getId());
+
+  printStats();
+}
+
+void
+SharingExecutor::printStats()
+{
+  microseconds total(0);
+  for (const Task& task : m_tasks)
+    total += task.executionTime;
+
+  double sharingTimeSec = static_cast<double>(total.count()) / MILLION;
+  LOGSTAT("Sharer %d: executionTime: %lf s, rounds: %u, average: %lf "
+          "s/round, threads: %zu",
+          this->getId(),
+          sharingTimeSec,
+          m_rounds.load(),
+          m_rounds ? sharingTimeSec / m_rounds : 0,
+          m_queues.size());
+
+  double medianOldestWait = 0;
+  if (!m_latencies.empty()) {
+    auto middle = m_latencies.begin() + m_latencies.size() / 2;
+    std::nth_element(m_latencies.begin(), middle, m_latencies.end());
+    medianOldestWait = static_cast<double>(*middle) / 1000;
+  }
+  LOGSTAT("Sharer %d: rounds woken by volume: %u, by short clause: %u, "
+          "mean clause wait: %lf ms, median wait of the oldest pending "
+          "clause: %lf ms",
+          this->getId(),
+          m_volumeRounds,
+          m_shortClauseRounds,
+          getMeanClauseWait(),
+          medianOldestWait);
+
+  for (const Task& task : m_tasks) {
+    LOGSTAT("Strategy '%s': executionTime: %lf s, runs: %u (stolen: %u), %s%s",
+            typeid(*task.strategy).name(),
+            static_cast<double>(task.executionTime.count()) / MILLION,
+            task.runs,
+            task.stolen,
+            task.strategy->getStatistics().toString().c_str(),
+            task.strategy->budgetsToString().c_str());
+  }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "sharing/Sharer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A Sharer running any number of strategies on a small pool of threads.
+ *
+ * @details Each strategy is a task with a due time (its previous run plus its
+ * sleeping time). Every worker owns a queue of tasks ordered by due time: it
+ * runs its earliest due task, or steals one that is due from another worker
+ * when its own are not, so that a long round (e.g. a global strategy waiting
+ * on MPI) does not delay the tasks queued behind it. A task is in exactly one
+ * queue or being run, thus a strategy never runs concurrently with itself.
+ *
+ * The number of workers caps the CPU used by sharing whatever the number of
+ * strategies, and the time spent in each strategy is reported at the end.
+ * @ingroup sharing
+ */
+class SharingExecutor : public Sharer
+{
+public:
+  /**
+   * @param manager the painless instance defining the solving lifecycle
+   * @param id_ the ID of the executor (as a sharer)
+   * @param sharingStrategies the strategies to run
+   * @param threadCount maximum number of worker threads (at least 1, at most
+   * one per strategy)
+   */
+  SharingExecutor(
+    PainlessImpl& manager,
+    int id_,
+    std::vector<std::shared_ptr<SharingStrategy>>& sharingStrategies,
+    unsigned threadCount);
+
+  ~SharingExecutor();
+
+  void join() override;
+
+  bool setCpuAffinity(const std::vector<int>& cpus) override;
+
+  void printStats() override;
+
+private:
+  /// A strategy and its scheduling data
+  struct Task
+  {
+    std::shared_ptr<SharingStrategy> strategy;
+    /// Index of the strategy in the notifier
+    unsigned source;
+    std::chrono::microseconds due;
+    std::chrono::microseconds executionTime{ 0 };
+    uint runs = 0;
+    uint stolen = 0;
+  };
+
+  /// Tasks owned by a worker, a min-heap on the due time
+  struct Queue
+  {
+    std::mutex mutex;
+    std::vector<Task*> heap;
+  };
+
+  /// Heap order of the queues: the earliest due task on top
+  static bool laterDue(const Task* a, const Task* b) { return a->due > b->due; }
+
+  void workerMain(unsigned worker);
+
+  /// Pop the earliest task of queue if it is due (or if force is set)
+  Task* popDue(Queue& queue, std::chrono::microseconds now, bool force);
+
+  void push(Queue& queue, Task* task);
+
+  /// Remove task from the queue holding it, false if it is being run
+  bool take(Task* task);
+
+  /// Earliest due time over all the queues
+  std::chrono::microseconds earliestDue();
+
+  /// Run a task and requeue it in the queue of the worker
+  void run(unsigned worker, Task* task);
+
+  std::vector<Task> m_tasks;
+  std::vector<std::unique_ptr<Queue>> m_queues;
+  std::vector<std::thread> m_workers;
+
+  /// Rounds done by the pool
+  std::atomic<uint> m_rounds = 0;
+};
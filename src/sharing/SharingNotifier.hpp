@@ -0,0 +1,251 @@
+#pragma once
+
+#include "painless/types.hpp"
+#include "utils/System.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+#include <linux/futex.h>
+#include <memory>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * @brief Wakes a Sharer before its sleeping time when enough clauses are
+ * waiting in one of its strategies.
+ *
+ * @details Each strategy of the Sharer is a source with its own pending state.
+ * Producers (through SharingStrategy::signalImport) add the size of each
+ * imported clause to the pending volume of the source. A source is triggered
+ * when its volume crosses a literal threshold or when a short clause (size at
+ * most shortClauseSize, e.g. units) arrives, and the Sharer then runs that
+ * strategy (see triggeredSource). The wake up is a single 32-bit word used as
+ * a futex: the waker pays a syscall only on the transition of a source from
+ * "no trigger" to "triggered", i.e. at most once per source and round.
+ *
+ * Each source also sums the import times of its pending clauses, so that
+ * reset gives the mean wait of the clauses taken by a round without
+ * timestamping them.
+ *
+ * A threshold of 0 disables the corresponding trigger, with both disabled the
+ * Sharer keeps its plain periodic behavior.
+ * @ingroup sharing
+ */
+class SharingNotifier
+{
+public:
+  /// Why waitFor returned
+  enum class Reason : uint32_t
+  {
+    NONE = 0,
+    TIMEOUT = 1,
+    VOLUME = 2,
+    SHORT_CLAUSE = 3,
+    EXTERNAL = 4
+  };
+
+  /// Waiting times of the clauses pending in a source when its round starts
+  struct Pending
+  {
+    /// Number of pending clauses
+    uint64_t clauses = 0;
+    /// Age of the oldest one
+    std::chrono::microseconds oldestWait{ 0 };
+    /// Sum of their ages
+    std::chrono::microseconds totalWait{ 0 };
+  };
+
+  /**
+   * @param sourceCount number of strategies of the Sharer
+   */
+  SharingNotifier(unsigned long volumeThreshold = 0,
+                  unsigned shortClauseSize = 0,
+                  unsigned sourceCount = 1)
+    : m_volumeThreshold(volumeThreshold)
+    , m_shortClauseSize(shortClauseSize)
+    , m_sourceCount(sourceCount)
+    , m_sources(std::make_unique<Source[]>(sourceCount))
+  {
+  }
+
+  bool enabled() const { return m_volumeThreshold || m_shortClauseSize; }
+
+  unsigned getSourceCount() const { return m_sourceCount; }
+
+  /**
+   * @brief Account for a clause that entered the database of a strategy.
+   * @param source index of the strategy in its Sharer
+   * @note Called concurrently by the producers.
+   */
+  void onImport(unsigned source, csize_t size)
+  {
+    Source& pending = m_sources[source];
+    const int64_t now =
+      SystemResourceMonitor::Timer::getAbsoluteTimeMicro().count();
+
+    pending.importTimes.fetch_add(now, std::memory_order_relaxed);
+    pending.clauses.fetch_add(1, std::memory_order_relaxed);
+    if (!pending.oldest.load(std::memory_order_relaxed)) {
+      int64_t expected = 0;
+      pending.oldest.compare_exchange_strong(expected, now);
+    }
+
+    if (size <= m_shortClauseSize) {
+      trigger(pending, Reason::SHORT_CLAUSE);
+    } else if (m_volumeThreshold &&
+               pending.volume.fetch_add(size, std::memory_order_relaxed) +
+                   size >=
+                 m_volumeThreshold) {
+      trigger(pending, Reason::VOLUME);
+    }
+  }
+
+  /// Wake the waiting Sharer (termination)
+  void notify() { wake(Reason::EXTERNAL); }
+
+  /**
+   * @brief Sleep until a trigger or the timeout, whichever comes first. A
+   * source triggered while the Sharer was busy makes it return immediately.
+   */
+  Reason waitFor(std::chrono::microseconds timeout)
+  {
+    auto deadline =
+      SystemResourceMonitor::Timer::getAbsoluteTimeMicro() + timeout;
+
+    while (true) {
+      uint32_t reason = m_trigger.exchange(0);
+      if (reason)
+        return static_cast<Reason>(reason);
+
+      // Sources left triggered by the previous wake up
+      for (unsigned i = 0; i < m_sourceCount; i++) {
+        reason = m_sources[i].trigger.load(std::memory_order_acquire);
+        if (reason)
+          return static_cast<Reason>(reason);
+      }
+
+      auto remaining =
+        deadline - SystemResourceMonitor::Timer::getAbsoluteTimeMicro();
+      if (remaining.count() <= 0)
+        return Reason::TIMEOUT;
+
+      struct timespec ts;
+      ts.tv_sec = remaining.count() / 1'000'000;
+      ts.tv_nsec = (remaining.count() % 1'000'000) * 1000;
+      // Returns on wake up, timeout, EINTR or if the word is no longer 0
+      syscall(SYS_futex,
+              reinterpret_cast<uint32_t*>(&m_trigger),
+              FUTEX_WAIT_PRIVATE,
+              0,
+              &ts,
+              nullptr,
+              0);
+    }
+  }
+
+  bool isTriggered(unsigned source) const
+  {
+    return m_sources[source].trigger.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief First triggered source in round-robin order from first.
+   * @return its index, -1 if no source is triggered
+   */
+  int triggeredSource(unsigned first) const
+  {
+    for (unsigned i = 0; i < m_sourceCount; i++) {
+      unsigned source = (first + i) % m_sourceCount;
+      if (isTriggered(source))
+        return source;
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Start a new round of a source: its trigger and pending volume are
+   * cleared.
+   * @return the waiting times of the clauses imported in the source since its
+   * previous round. Under concurrent imports a clause can be counted in the
+   * next round, the total is clamped at 0.
+   */
+  Pending reset(unsigned source)
+  {
+    Source& pending = m_sources[source];
+    pending.trigger.store(0, std::memory_order_release);
+    pending.volume.store(0, std::memory_order_relaxed);
+
+    Pending result;
+    int64_t oldest = pending.oldest.exchange(0);
+    result.clauses = pending.clauses.exchange(0);
+    int64_t importTimes = pending.importTimes.exchange(0);
+    if (!oldest || !result.clauses)
+      return result;
+
+    const int64_t now =
+      SystemResourceMonitor::Timer::getAbsoluteTimeMicro().count();
+    result.oldestWait = std::chrono::microseconds(now - oldest);
+    result.totalWait = std::chrono::microseconds(std::max<int64_t>(
+      0, now * static_cast<int64_t>(result.clauses) - importTimes));
+    return result;
+  }
+
+private:
+  /// Pending state of a strategy, on its own cache line
+  struct alignas(64) Source
+  {
+    /// Reason of the pending trigger of the source (NONE if none)
+    std::atomic<uint32_t> trigger{ 0 };
+    /// Literals imported since the last round
+    std::atomic<unsigned long> volume{ 0 };
+    /// Clauses imported since the last round and the sum of their import
+    /// times (absolute us)
+    std::atomic<uint64_t> clauses{ 0 };
+    std::atomic<int64_t> importTimes{ 0 };
+    /// Import time (absolute us) of the oldest clause since the last round
+    std::atomic<int64_t> oldest{ 0 };
+  };
+
+  void trigger(Source& source, Reason reason)
+  {
+    // Already triggered, the Sharer will be (or is) awake
+    if (source.trigger.load(std::memory_order_relaxed))
+      return;
+    uint32_t expected = 0;
+    if (source.trigger.compare_exchange_strong(expected,
+                                               static_cast<uint32_t>(reason)))
+      wake(reason);
+  }
+
+  void wake(Reason reason)
+  {
+    uint32_t expected = 0;
+    if (m_trigger.compare_exchange_strong(expected,
+                                          static_cast<uint32_t>(reason))) {
+      syscall(SYS_futex,
+              reinterpret_cast<uint32_t*>(&m_trigger),
+              FUTEX_WAKE_PRIVATE,
+              1,
+              nullptr,
+              nullptr,
+              0);
+    }
+  }
+
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+                "the futex word must be a plain 32-bit integer");
+
+  /// Futex word, the Reason of the last wake up (NONE if consumed)
+  std::atomic<uint32_t> m_trigger{ 0 };
+
+  const unsigned long m_volumeThreshold;
+  const unsigned m_shortClauseSize;
+
+  const unsigned m_sourceCount;
+  std::unique_ptr<Source[]> m_sources;
+};
@@ -1,12 +1,18 @@
 #pragma once
 
+#include "ReinforcedSelection.hpp"
+#include "SelectionSubsumption.hpp"
 #include "SharingEntity.hpp"
+#include "SharingNotifier.hpp"
+#include "UnitChannel.hpp"
 #include "containers/ClauseDatabase.hpp"
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <memory>
 #include <mutex>
 #include <set>
+#include <unordered_map>
 
 /**
  * @brief SharingStrategy class, inheriting from SharingEntity. It defines how a
@@ -43,6 +49,14 @@ public:
       oss << " -receivedCls: " << receivedClauses.load() << std::endl;
       oss << " -sharedCls: " << sharedClauses << std::endl;
       oss << " -filteredAtImport: " << filteredAtImport.load() << std::endl;
+      oss << " -rootSatisfiedCls: " << rootSatisfiedClauses.load()
+          << std::endl;
+      oss << " -rootSavedLits: " << rootSavedLiterals.load() << std::endl;
+      oss << " -budgetWithheldCls: " << budgetWithheldClauses << std::endl;
+      oss << " -mergedArrivals: " << mergedArrivals << std::endl;
+      oss << " -reinforcedCls: " << reinforcedClauses << std::endl;
+      oss << " -subsumedCls: " << subsumedClauses << std::endl;
+      oss << " -strengthenedLits: " << strengthenedLiterals << std::endl;
 
       return oss.str();
     }
@@ -55,6 +69,29 @@ public:
 
     /// Number of clause filtered at import
     std::atomic<unsigned long> filteredAtImport{ 0 };
+
+    /// Clauses dropped at import as satisfied by a known root unit
+    std::atomic<unsigned long> rootSatisfiedClauses{ 0 };
+
+    /// Literals not stored: those of the satisfied clauses and the falsified
+    /// literals stripped from the others
+    std::atomic<unsigned long> rootSavedLiterals{ 0 };
+
+    /// Clauses not sent to a client as over its import budget (one count per
+    /// client), see setImportBudgets
+    unsigned long budgetWithheldClauses{ 0 };
+
+    /// Duplicate arrivals merged by the reinforced selection
+    unsigned long mergedArrivals{ 0 };
+
+    /// Shared clauses learnt by several producers in the same round
+    unsigned long reinforcedClauses{ 0 };
+
+    /// Selected clauses dropped as subsumed, see setSubsumption
+    unsigned long subsumedClauses{ 0 };
+
+    /// Literals removed from the selected clauses, see setSubsumption
+    unsigned long strengthenedLiterals{ 0 };
   };
 
   /**
@@ -93,7 +130,279 @@ public:
    */
   virtual const Statistics& getStatistics() const = 0;
 
+  /**
+   * @brief Set the notifier of the Sharer running this strategy, it is told
+   * about every imported clause (see signalImport).
+   * @param source index of this strategy in the Sharer
+   */
+  void setNotifier(std::shared_ptr<SharingNotifier> notifier, unsigned source)
+  {
+    m_notifier = std::move(notifier);
+    m_notifierSource = source;
+  }
+
+  /**
+   * @brief Give the table of globally known root units: the imported units
+   * feed it and the other imported clauses are simplified with it (see
+   * simplifyAtIngress).
+   * @warning To be set before solving
+   */
+  void setRootUnits(std::shared_ptr<UnitChannel> rootUnits)
+  {
+    m_rootUnits = std::move(rootUnits);
+  }
+
+  /**
+   * @brief True if the strategy relies on notifyClauseUsed, the solvers then
+   * track their imports to report the used ones.
+   */
+  virtual bool wantsUsageFeedback() const { return false; }
+
+  /**
+   * @brief Bound the clauses sent to each client per round by its measured
+   * consumption (see exportClausesWithinBudgets).
+   * @param drainFactor a client gets at most drainFactor times the clauses it
+   * consumes per round (0 disables the budgets)
+   * @param backlogTarget clauses a client may have waiting in its import
+   * database, nothing more is sent to it beyond
+   * @warning To be set before solving
+   */
+  void setImportBudgets(double drainFactor, size_t backlogTarget)
+  {
+    m_budgetDrainFactor = drainFactor;
+    m_budgetBacklogTarget = backlogTarget;
+  }
+
+  /**
+   * @brief Per client import budget state, by sharing id: drain rate and
+   * budget of the last round, clauses sent and withheld (empty when the
+   * budgets are disabled, see setImportBudgets).
+   * @note Not synchronized with the sharer thread, to be read once it ended.
+   */
+  std::string budgetsToString() const
+  {
+    std::vector<int> ids;
+    for (const auto& entry : m_consumerLoads)
+      ids.push_back(entry.first);
+    std::sort(ids.begin(), ids.end());
+
+    std::ostringstream oss;
+    for (int id : ids) {
+      const ConsumerLoad& load = m_consumerLoads.at(id);
+      oss << " -client " << id << ": drainRate " << load.drainRate
+          << ", budget " << load.budget << ", sent " << load.sent
+          << ", withheld " << load.withheld << std::endl;
+    }
+    return oss.str();
+  }
+
+  /**
+   * @brief Merge the copies of a clause arrived in the same round and select
+   * the clauses learnt by the most producers first (see ReinforcedSelection).
+   * @warning To be set before solving
+   */
+  void setReinforcement(bool enabled)
+  {
+    if (enabled)
+      m_reinforcement = std::make_unique<ReinforcedSelection>();
+    else
+      m_reinforcement.reset();
+  }
+
+  /**
+   * @brief Simplify the selection of each round by subsumption and
+   * strengthening before its export (see SelectionSubsumption).
+   * @param budget time spent per round (0 disables the stage)
+   * @warning To be set before solving
+   */
+  void setSubsumption(std::chrono::microseconds budget)
+  {
+    if (budget.count() > 0)
+      m_subsumption = std::make_unique<SelectionSubsumption>(budget);
+    else
+      m_subsumption.reset();
+  }
+
 protected:
+  /**
+   * @brief Selection of the round from db, through the reinforced selection
+   * when enabled (see setReinforcement), db.giveSelection otherwise. The
+   * selection is then simplified when setSubsumption enabled it.
+   * @param stats where the merged, reinforced, subsumed clauses and the
+   * removed literals are counted
+   * @return the number of selected clauses
+   */
+  size_t selectClauses(ClauseDatabase& db,
+                       std::vector<ClauseExchangePtr>& selection,
+                       unsigned literalCountLimit,
+                       Statistics& stats)
+  {
+    if (!m_reinforcement) {
+      db.giveSelection(selection, literalCountLimit);
+    } else {
+      ReinforcedSelection::Counts counts =
+        m_reinforcement->select(db, selection, literalCountLimit);
+      stats.mergedArrivals += counts.mergedArrivals;
+      stats.reinforcedClauses += counts.reinforcedClauses;
+    }
+
+    if (m_subsumption) {
+      SelectionSubsumption::Counts counts = m_subsumption->simplify(selection);
+      stats.subsumedClauses += counts.subsumedClauses;
+      stats.strengthenedLiterals += counts.strengthenedLiterals;
+      if (counts.interrupted)
+        LOG3("[Subsumption] budget reached, part of the selection is left as "
+             "is");
+    }
+    return selection.size();
+  }
+
+  /**
+   * @brief exportClauses with a budget per client when setImportBudgets
+   * enabled them: the units always pass, the other clauses are sent in order
+   * until the client accepted its budget.
+   * @details The budget is the room left below the backlog target, bounded by
+   * the drain factor times the drain rate of the client (at least one clause
+   * per round). The drain of a round is the previous backlog plus the clauses
+   * this strategy got accepted minus the current backlog, averaged over the
+   * rounds: a lower bound when other strategies feed the same client. The
+   * accepted units count in the drain (Kissat and CaDiCaL queue them with the
+   * other clauses, the backends queuing them apart see a drain higher by the
+   * few units of the round) but not in the budget. The clients not measuring
+   * their backlog (see getImportBacklog) get everything.
+   * @param clauses the selection of the round, best clauses first
+   * @param stats where the withheld clauses are counted
+   * @note Only called by the sharer thread of the strategy.
+   */
+  void exportClausesWithinBudgets(const std::vector<ClauseExchangePtr>& clauses,
+                                  Statistics& stats)
+  {
+    if (m_budgetDrainFactor <= 0) {
+      exportClauses(clauses);
+      return;
+    }
+
+    const ClientsGuard clients = getClients();
+    for (const std::shared_ptr<SharingEntity>& client : *clients) {
+      const std::optional<size_t> backlog = client->getImportBacklog();
+      if (!backlog) {
+        for (const ClauseExchangePtr& clause : clauses)
+          exportClauseTo(clause, client);
+        continue;
+      }
+
+      ConsumerLoad& load = m_consumerLoads[client->getSharingId()];
+      if (load.drainRate >= 0 || load.accepted) {
+        const double drained =
+          std::max(0.0, static_cast<double>(load.backlog + load.accepted) -
+                          static_cast<double>(*backlog));
+        load.drainRate = load.drainRate < 0
+                           ? drained
+                           : (1 - DRAIN_SMOOTHING) * load.drainRate +
+                               DRAIN_SMOOTHING * drained;
+      }
+      load.backlog = *backlog;
+      load.accepted = 0;
+
+      size_t budget = *backlog < m_budgetBacklogTarget
+                        ? m_budgetBacklogTarget - *backlog
+                        : 0;
+      if (load.drainRate >= 0)
+        budget = std::min<size_t>(
+          budget,
+          std::ceil(m_budgetDrainFactor * std::max(load.drainRate, 1.0)));
+
+      size_t spent = 0;
+      for (const ClauseExchangePtr& clause : clauses) {
+        if (clause->size == 1) {
+          load.accepted += exportClauseTo(clause, client);
+        } else if (spent >= budget) {
+          stats.budgetWithheldClauses++;
+          load.withheld++;
+        } else if (exportClauseTo(clause, client)) {
+          load.accepted++;
+          spent++;
+        }
+      }
+      load.budget = budget;
+      load.sent += load.accepted;
+
+      LOG3("[Budgets] client %d: backlog %zu, drain rate %.1f, budget %zu, "
+           "accepted %zu",
+           client->getSharingId(),
+           *backlog,
+           load.drainRate,
+           budget,
+           load.accepted);
+    }
+  }
+
+  /**
+   * @brief Simplify a clause entering the strategy with the known root units.
+   * A unit is recorded, a clause satisfied by a root unit is to be dropped and
+   * the falsified literals of the others are stripped (in a copy, the clause
+   * being shared with the other clients of its producer).
+   * @param clause the imported clause
+   * @param stripped set to the copy without the falsified literals, left
+   * untouched if there are none
+   * @param stats where the saved clauses and literals are counted
+   * @return false if the clause is satisfied
+   * @note Called concurrently by the producers.
+   */
+  bool simplifyAtIngress(const ClauseExchangePtr& clause,
+                         ClauseExchangePtr& stripped,
+                         Statistics& stats)
+  {
+    if (!m_rootUnits)
+      return true;
+
+    if (clause->size == 1) {
+      m_rootUnits->publish(clause->lits[0], clause->from);
+      return true;
+    }
+
+    thread_local std::vector<lit_t> kept;
+    kept.clear();
+    for (lit_t lit : *clause) {
+      int8_t value = m_rootUnits->value(lit);
+      if (value > 0) {
+        stats.rootSatisfiedClauses++;
+        stats.rootSavedLiterals += clause->size;
+        return false;
+      }
+      if (!value)
+        kept.push_back(lit);
+    }
+
+    // All falsified: the clause is kept as is for the solvers to conclude
+    if (kept.size() == clause->size || kept.empty())
+      return true;
+
+    stats.rootSavedLiterals += clause->size - kept.size();
+    lbd_t lbd = std::min<lbd_t>(clause->lbd, kept.size());
+    stripped = ClauseExchange::create(kept, lbd, clause->from);
+    if (kept.size() == 1)
+      m_rootUnits->publish(kept[0], clause->from);
+    return true;
+  }
+
+  /// Globally known root units (can be null)
+  std::shared_ptr<UnitChannel> m_rootUnits;
+
+  /**
+   * @brief To be called by importClause once a clause is stored for the next
+   * doSharing, may wake up the Sharer early.
+   */
+  void signalImport(const ClauseExchangePtr& clause)
+  {
+    if (m_notifier)
+      m_notifier->onImport(m_notifierSource, clause->size);
+  }
+
+  /// Notifier of the Sharer executing this strategy (can be null)
+  std::shared_ptr<SharingNotifier> m_notifier;
+  unsigned m_notifierSource = 0;
+
   /**
    * @brief A SharingStrategy doesn't send a clause to the source client (->from
    * must store the sharingId of its producer)
@@ -106,4 +415,36 @@ protected:
     else
       return false;
   }
+
+  /// Consumption of a client, see exportClausesWithinBudgets
+  struct ConsumerLoad
+  {
+    /// Backlog read at the previous round
+    size_t backlog = 0;
+
+    /// Clauses the client accepted at the previous round, units included
+    size_t accepted = 0;
+
+    /// Smoothed clauses consumed per round, negative until measured
+    double drainRate = -1;
+
+    /// Budget of the previous round, clauses sent and withheld in all
+    size_t budget = 0;
+    unsigned long sent = 0;
+    unsigned long withheld = 0;
+  };
+
+  /// Weight of the last round in the drain rates
+  static constexpr double DRAIN_SMOOTHING = 0.5;
+
+  /// Import budgets (see setImportBudgets), disabled by default
+  double m_budgetDrainFactor = 0;
+  size_t m_budgetBacklogTarget = 0;
+  std::unordered_map<int, ConsumerLoad> m_consumerLoads;
+
+  /// See setReinforcement, null when disabled
+  std::unique_ptr<ReinforcedSelection> m_reinforcement;
+
+  /// See setSubsumption, null when disabled
+  std::unique_ptr<SelectionSubsumption> m_subsumption;
 };
\ No newline at end of file
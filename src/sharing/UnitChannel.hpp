@@ -0,0 +1,193 @@
+#pragma once
+
+#include "painless/types.hpp"
+#include "utils/Logger.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+
+/**
+ * @brief Fast lane for root level units, shared by all the CDCL solvers.
+ *
+ * @details A unit is published as soon as it is learnt, without going through
+ * the sharing strategies and their sleep period. Two structures are kept:
+ * - a per-variable root assignment table (0 unknown, 1 true, -1 false) that
+ *   deduplicates the units and detects two opposite units (the formula is
+ *   then UNSAT, both being implied by it);
+ * - an append-only log of the new units, each consumer reads it from its own
+ *   cursor at its import points.
+ *
+ * Both are segmented arrays whose segments double in size and are allocated
+ * on first use with a CAS, so the channel does not need the variable count
+ * and nothing is ever moved: publish and poll are lock-free.
+ * @ingroup sharing
+ */
+class UnitChannel
+{
+public:
+  UnitChannel() = default;
+  UnitChannel(const UnitChannel&) = delete;
+  UnitChannel& operator=(const UnitChannel&) = delete;
+
+  /**
+   * @brief Publish a unit.
+   * @param lit the unit literal
+   * @param producer sharing id of the publisher (kept for the conflict)
+   * @return false if the opposite unit was already published
+   */
+  bool publish(lit_t lit, int producer)
+  {
+    const int8_t sign = lit > 0 ? 1 : -1;
+    int8_t expected = 0;
+    if (m_values.at(std::abs(lit))
+          .compare_exchange_strong(expected, sign, std::memory_order_acq_rel)) {
+      size_t index = m_logSize.fetch_add(1, std::memory_order_relaxed);
+      m_log.at(index).store(lit, std::memory_order_release);
+      return true;
+    }
+
+    if (expected == sign)
+      return true;
+
+    // The producer is stored with the literal, a reader seeing the conflict
+    // also sees who published it
+    uint64_t none = 0;
+    if (m_conflict.compare_exchange_strong(
+          none, packConflict(lit, producer), std::memory_order_acq_rel)) {
+      LOG1("Unit channel: %d was published while %d is known, UNSAT",
+           lit,
+           -lit);
+    }
+    return false;
+  }
+
+  /**
+   * @brief Hand the units published since cursor to consume, in publication
+   * order. A unit still being written ends the poll, it is read next time.
+   * @param cursor consumer position in the log, updated
+   * @return false if two opposite units were published
+   */
+  template<typename Consumer>
+  bool poll(size_t& cursor, Consumer&& consume) const
+  {
+    const size_t end = m_logSize.load(std::memory_order_acquire);
+    while (cursor < end) {
+      const std::atomic<lit_t>* slot = m_log.find(cursor);
+      lit_t lit = slot ? slot->load(std::memory_order_acquire) : 0;
+      if (!lit)
+        break;
+      consume(lit);
+      cursor++;
+    }
+    return !hasConflict();
+  }
+
+  /// Root value of a literal: 1 true, -1 false, 0 unknown
+  int8_t value(lit_t lit) const
+  {
+    const std::atomic<int8_t>* slot = m_values.find(std::abs(lit));
+    int8_t value = slot ? slot->load(std::memory_order_acquire) : 0;
+    return lit > 0 ? value : -value;
+  }
+
+  bool hasConflict() const
+  {
+    return m_conflict.load(std::memory_order_acquire) != 0;
+  }
+
+  /// The unit whose publication found its opposite (0 if none)
+  lit_t getConflictLiteral() const
+  {
+    return static_cast<lit_t>(
+      static_cast<uint32_t>(m_conflict.load(std::memory_order_acquire)));
+  }
+
+  /// Sharing id of the publisher of the conflicting unit (-1 if none)
+  int getConflictProducer() const
+  {
+    const uint64_t conflict = m_conflict.load(std::memory_order_acquire);
+    return conflict ? static_cast<int>(static_cast<uint32_t>(conflict >> 32))
+                    : -1;
+  }
+
+  /// Number of distinct units published
+  size_t size() const { return m_logSize.load(std::memory_order_relaxed); }
+
+private:
+  /// Producer in the high half, literal (never 0) in the low half
+  static uint64_t packConflict(lit_t lit, int producer)
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(producer)) << 32) |
+           static_cast<uint32_t>(lit);
+  }
+
+  /// Lock-free growable array of atomics, index i lives in segment
+  /// floor(log2(i / FIRST_SEGMENT_SIZE + 1)) which holds
+  /// FIRST_SEGMENT_SIZE << segment entries
+  template<typename T>
+  class Segments
+  {
+  public:
+    static constexpr size_t FIRST_SEGMENT_SIZE = 1 << 12;
+    static constexpr unsigned SEGMENT_COUNT = 40;
+
+    ~Segments()
+    {
+      for (auto& segment : m_segments)
+        delete[] segment.load();
+    }
+
+    /// Entry of index, its segment is allocated if needed
+    std::atomic<T>& at(size_t index)
+    {
+      auto [segment, offset] = locate(index);
+      std::atomic<T>* entries =
+        m_segments[segment].load(std::memory_order_acquire);
+      if (!entries) {
+        // Value initialized (C++20 atomics), the loser frees its copy
+        std::atomic<T>* fresh =
+          new std::atomic<T>[FIRST_SEGMENT_SIZE << segment]();
+        if (m_segments[segment].compare_exchange_strong(
+              entries, fresh, std::memory_order_acq_rel)) {
+          entries = fresh;
+        } else {
+          delete[] fresh;
+        }
+      }
+      return entries[offset];
+    }
+
+    /// Entry of index, nullptr if its segment was never allocated
+    const std::atomic<T>* find(size_t index) const
+    {
+      auto [segment, offset] = locate(index);
+      const std::atomic<T>* entries =
+        m_segments[segment].load(std::memory_order_acquire);
+      return entries ? entries + offset : nullptr;
+    }
+
+  private:
+    static std::pair<unsigned, size_t> locate(size_t index)
+    {
+      const size_t block = index / FIRST_SEGMENT_SIZE + 1;
+      const unsigned segment = std::bit_width(block) - 1;
+      return { segment,
+               index - FIRST_SEGMENT_SIZE * ((size_t(1) << segment) - 1) };
+    }
+
+    std::atomic<std::atomic<T>*> m_segments[SEGMENT_COUNT] = {};
+  };
+
+  /// Root assignment per variable
+  Segments<int8_t> m_values;
+
+  /// Published units, 0 while a slot is being written
+  Segments<lit_t> m_log;
+  std::atomic<size_t> m_logSize = 0;
+
+  /// First conflicting unit and its producer, packed by packConflict
+  std::atomic<uint64_t> m_conflict = 0;
+};
@@ -70,6 +70,7 @@ Cadical::solve(cube_view_t cube)
        cube.size());
 
   int res = solver->solve();
+  flushExports();
 
   if (res == 10) {
     LOG2("Cadical %d responded with SAT", this->getSolverId());
@@ -79,6 +80,11 @@ Cadical::solve(cube_view_t cube)
     LOG2("Cadical %d responded with UNSAT", this->getSolverId());
     return SatAnswer::UNSAT;
   }
+  if (m_unitConflict) {
+    LOG2("Cadical %d was stopped by conflicting units, UNSAT",
+         this->getSolverId());
+    return SatAnswer::UNSAT;
+  }
   LOGD2("Cadical %d responded with %d (UNKNOWN)", this->getSolverId(), res);
   return SatAnswer::UNKNOWN;
 }
@@ -303,47 +309,42 @@ Cadical::importClause(const ClauseExchangePtr& clause)
 // Learner
 // =======
 
-bool
+int*
 Cadical::learning(int size, int glue)
 {
-  if (size > 0) {
+  if (size > 0 && exportAdmissible(size, glue)) {
     LOGD4("Cadical %d will export clause of size %d, glue %d",
           this->getSolverId(),
           size,
           glue);
-    m_tempClause.reserve(size);
-    m_tempLbd = glue;
-    return true;
+    // CaDiCaL writes the external literals directly in the exchange object
+    m_clauseToExport = ClauseExchange::create(size, glue, this->getSharingId());
+    return m_clauseToExport->lits;
   } else {
-    return false;
+    return nullptr;
   }
 }
 
 void
-Cadical::learn(int lit)
+Cadical::learned()
 {
-  if (lit)
-    m_tempClause.push_back(lit);
-  else {
-    assert(m_tempClause.size() > 0 && m_tempLbd >= 0);
-    auto exportedClause =
-      ClauseExchange::create(m_tempClause, m_tempLbd, this->getSharingId());
-
-    assert(m_tempClause.size() == exportedClause->size);
-    assert((exportedClause->size > 1 && exportedClause->lbd > 0) ||
-           (exportedClause->size == 1 && exportedClause->lbd >= 0));
-
-    /* filtering defined by a sharing strategy, done here in case it checks its
-     * literals */
-    if (this->exportClause(exportedClause)) {
-      LOGDVECTOR4(exportedClause->lits,
-                  exportedClause->size,
-                  "Cadical %d exported Clause %p for sharing",
-                  this->getSolverId(),
-                  exportedClause.get());
-    }
-    m_tempClause.clear();
+  assert(m_clauseToExport && m_clauseToExport->size > 0);
+  assert((m_clauseToExport->size > 1 && m_clauseToExport->lbd > 0) ||
+         (m_clauseToExport->size == 1 && m_clauseToExport->lbd >= 0));
+
+  if (m_clauseToExport->size == 1)
+    publishUnit(m_clauseToExport->lits[0]);
+
+  /* filtering defined by a sharing strategy, done here in case it checks its
+   * literals */
+  if (this->stageExport(m_clauseToExport)) {
+    LOGDVECTOR4(m_clauseToExport->lits,
+                m_clauseToExport->size,
+                "Cadical %d exported Clause %p for sharing",
+                this->getSolverId(),
+                m_clauseToExport.get());
   }
+  m_clauseToExport.reset();
 }
 
 bool
@@ -369,6 +370,29 @@ Cadical::hasClauseToImport()
   // 		 getSolverTypeId(),
   // 		 (m_fullReaderIndex - oldIndex));
 
+  flushExports();
+
+  refreshRejectedLiterals(solver->vars(),
+                          solver->getActiveVariables(),
+                          [this](unsigned char* states, unsigned vars) {
+                            solver->getImportRejectedLiterals(states, vars);
+                          });
+
+  exchangePhases(solver->vars(),
+                 [this](signed char* phases,
+                        unsigned vars,
+                        PhaseChannel::Source source) {
+                   solver->getPhases(phases, vars, static_cast<int>(source));
+                 });
+
+  // Fast lane units first, a conflict between them stops the search
+  if (m_unitsToImport.empty() && !pollUnits(m_unitsToImport)) {
+    m_unitConflict = true;
+    return false;
+  }
+  if (!m_unitsToImport.empty())
+    return true;
+
   if (this->m_clausesToImport->getOneClause(m_tempClauseToImport)) {
     if (m_tempClauseToImport->lbd)
       LOGD4("Cadical %u will import redundant clause %s",
@@ -386,22 +410,36 @@ Cadical::hasClauseToImport()
 }
 
 void
-Cadical::getClauseToImport(std::vector<int>& clause, int& glue)
+Cadical::getClauseToImport(const int*& lits, int& size, int& glue)
 {
-  assert(clause.empty());
-  clause.insert(
-    clause.end(), m_tempClauseToImport->begin(), m_tempClauseToImport->end());
-  assert(clause.size() && clause.size() == m_tempClauseToImport->size &&
-         clause[0] == m_tempClauseToImport->lits[0]);
+  if (!m_unitsToImport.empty()) {
+    m_unitToImport = m_unitsToImport.back();
+    m_unitsToImport.pop_back();
+    lits = &m_unitToImport;
+    size = 1;
+    glue = 0;
+    return;
+  }
 
+  // CaDiCaL reads the literals in place, m_tempClauseToImport keeps them
+  // alive until the next hasClauseToImport
+  lits = m_tempClauseToImport->lits;
+  size = m_tempClauseToImport->size;
   glue = m_tempClauseToImport->lbd;
-  LOGDVECTOR4(clause.data(),
-              clause.size(),
+  this->trackImport(*m_tempClauseToImport);
+  LOGDVECTOR4(lits,
+              size,
               "Cadical %d will import Clause (lbd:%u)",
               this->getSolverId(),
               glue);
 }
 
+void
+Cadical::usedImportedClause(const int* lits, int size)
+{
+  this->reportUsedImport(lits, size);
+}
+
 // ==================================================================
 // Variable Management
 // ==================================================================
@@ -424,6 +462,13 @@ Cadical::setPhase(const var_t var, const bool phase)
   solver->savePhase((phase) ? var : -var);
 }
 
+void
+Cadical::setPhaseHint(const var_t var, const bool phase)
+{
+  // Called at the import points: savePhase would internalize the variable
+  solver->setPhaseHint((phase) ? var : -var);
+}
+
 void
 Cadical::bumpVariableActivity(const var_t var, const int times)
 {
@@ -61,11 +61,16 @@ public:
 
   /* Sharing */
   bool importClause(const ClauseExchangePtr& clause) override;
+  std::optional<size_t> getImportBacklog() const override
+  {
+    return m_clausesToImport->getSize();
+  }
 
   /* Variable Management */
   uint getVariableCount() override;
   var_t getDivisionVariable() override;
   void setPhase(const var_t var, const bool phase) override;
+  void setPhaseHint(const var_t var, const bool phase) override;
   void bumpVariableActivity(const var_t var, const int times) override;
 
   /* Result & Solution */
@@ -107,18 +112,20 @@ protected:
   /// safe
 public:
   /* Export */
-  /// @brief  Tells if CaDiCaL should export a clause
-  /// @param size size of the clause to export
-  /// @param glue lbd value of the clause to export
-  /// @return true if the clause is to be exported, false otherwise
-  bool learning(int size, int glue) override;
+  /**
+   * @brief Tells if CaDiCaL should export a clause
+   * @param size size of the clause to export
+   * @param glue lbd value of the clause to export
+   * @return the literal array of a new exchange clause in which CaDiCaL
+   * writes the clause, nullptr if the clause is not to be exported
+   */
+  int* learning(int size, int glue) override;
 
   /**
-   * @brief Used by the base solver to export a clause
-   * @param lit a literal of the clause to export (non zero integer), 0 if it is
-   * the end
+   * @brief Used by the base solver once the clause returned by learning is
+   * written: the clause is exported as is
    */
-  void learn(int lit) override;
+  void learned() override;
 
   /* Import */
   /**
@@ -128,27 +135,43 @@ public:
   bool hasClauseToImport() override;
 
   /**
-   * @brief Loads the clause to import data in the parameters
-   * @param clause holds the clause literals
-   * @param glue holds the lbd value of the clause
+   * @brief Hands out the clause to import without copying it
+   * @param lits set to the clause literals, valid until the next call to
+   * hasClauseToImport
+   * @param size set to the clause size
+   * @param glue set to the lbd value of the clause
    */
-  void getClauseToImport(std::vector<int>& clause, int& glue) override;
+  void getClauseToImport(const int*& lits, int& size, int& glue) override;
 
-private:
-  /// A vector to store the clause to export
-  clause_t m_tempClause;
+  /**
+   * @brief Reports an imported clause used in a conflict analysis
+   * @param lits external literals of the clause
+   * @param size number of literals
+   */
+  void usedImportedClause(const int* lits, int size) override;
 
-  /// Stores the lbd value of the clause to export (loaded in learning)
-  int m_tempLbd;
+private:
+  /// The clause being exported (created in learning)
+  ClauseExchangePtr m_clauseToExport;
 
-  /// A pointer pointing to the next clause to be exported (loaded in
+  /// A pointer pointing to the next clause to be imported (loaded in
   /// hasClauseToImport)
   ClauseExchangePtr m_tempClauseToImport;
 
+  /// Storage of the fast lane unit handed out by getClauseToImport
+  lit_t m_unitToImport = 0;
+
+  /// Units read from the unit channel, imported before the shared clauses
+  std::vector<lit_t> m_unitsToImport;
+
+  /// The unit channel found two opposite units: the search is stopped and
+  /// answers UNSAT
+  bool m_unitConflict = false;
+
   /*-----------------------Terminator----------------------*/
   /**
    * @brief Callback for the base solver to check if it should terminate or not
    * @return true if the base solver should terminate, false otherwise
    */
-  bool terminate() { return this->stopSolver; }
+  bool terminate() { return this->stopSolver || m_unitConflict; }
 };
\ No newline at end of file
@@ -54,8 +54,10 @@ glucoseExportUnary(void* issuer, Glucose::Lit& l)
 
   ncls->lits[0] = INT_LIT(l);
 
+  gs->publishUnit(ncls->lits[0]);
+
   /* filtering defined by a sharing strategy */
-  gs->exportClause(ncls);
+  gs->stageExport(ncls);
 }
 
 void
@@ -63,6 +65,9 @@ glucoseExportClause(void* issuer, Glucose::Clause& cls)
 {
   GlucoseSyrup* gs = (GlucoseSyrup*)issuer;
 
+  if (!gs->exportAdmissible(cls.size(), cls.lbd()))
+    return;
+
   ClauseExchangePtr ncls =
     ClauseExchange::create(cls.size(), cls.lbd(), gs->getSharingId());
 
@@ -71,7 +76,7 @@ glucoseExportClause(void* issuer, Glucose::Clause& cls)
   }
 
   /* filtering defined by a sharing strategy */
-  gs->exportClause(ncls);
+  gs->stageExport(ncls);
 }
 
 Glucose::Lit
@@ -81,12 +86,21 @@ glucoseImportUnary(void* issuer)
 
   Glucose::Lit l;
 
-  std::vector<int> units;
+  // Called first at each import point (root level)
+  gs->flushExports();
+
+  // Pending units are kept between calls, Glucose calls us until lit_Undef
+  std::vector<lit_t>& units = gs->m_pendingUnits;
 
   gs->m_unitsToImport.consume_all(
     [&units](int unit) { units.push_back(unit); });
 
-  for (lit_t lit : units) {
+  if (!gs->pollUnits(units))
+    gs->m_unitConflict = true;
+
+  while (!units.empty()) {
+    lit_t lit = units.back();
+    units.pop_back();
     l = GLUE_LIT(lit);
 
     if (checkLiteral(l, gs->solver) == true) {
@@ -108,6 +122,18 @@ glucoseImportClause(void* issuer,
 
   ClauseExchangePtr cls;
 
+  // Opposite units on the unit channel: the empty clause ends the search.
+  // Glucose asserts that an imported clause comes from another thread and the
+  // producer may be this solver: any other id is fine, the clause is not kept
+  if (gs->m_unitConflict) {
+    const int self = gs->getSharingId();
+    const int producer = gs->m_unitChannel->getConflictProducer();
+    gcls.clear();
+    *from = (producer >= 0 && producer != self) ? producer : self + 1;
+    *lbd = 1;
+    return true;
+  }
+
   while (gs->m_clausesToImport->getOneClause(cls)) {
     if (makeGlueVec(cls, gcls, gs->solver)) {
       *from = cls->from;
@@ -412,6 +438,7 @@ GlucoseSyrup::solve(cube_view_t cube)
        cube.size());
 
   Glucose::lbool res = solver->solveLimited(gAssumptions);
+  flushExports();
 
   if (res == l_True)
     return SatAnswer::SAT;
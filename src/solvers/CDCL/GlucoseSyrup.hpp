@@ -57,6 +57,10 @@ public:
 
   /* Sharing */
   bool importClause(const ClauseExchangePtr& clause) override;
+  std::optional<size_t> getImportBacklog() const override
+  {
+    return m_clausesToImport->getSize();
+  }
 
   /* Variable Management */
   uint getVariableCount() override;
@@ -108,6 +112,12 @@ protected:
   boost::lockfree::queue<int, boost::lockfree::fixed_sized<false>>
     m_unitsToImport;
 
+  /// Units read from m_unitsToImport and the unit channel, not yet imported
+  std::vector<lit_t> m_pendingUnits;
+
+  /// The unit channel found two opposite units
+  bool m_unitConflict = false;
+
   /// @brief Database used to import shared clauses. Can be common with other
   /// solvers
   std::shared_ptr<ClauseDatabase> m_clausesToImport;
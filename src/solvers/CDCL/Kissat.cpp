@@ -48,6 +48,13 @@ kissatExportClause(void* vpkissat)
   return pkissat->backendExplortClause();
 }
 
+void
+kissatImportedClauseUsed(void* vpkissat, const int* lits, unsigned size)
+{
+  Kissat* pkissat = static_cast<Kissat*>(vpkissat);
+  pkissat->reportUsedImport(lits, size);
+}
+
 // ==================================================================
 
 Kissat::Kissat(int id,
@@ -65,9 +72,13 @@ Kissat::Kissat(int id,
   kissat_set_export_call(m_solver, kissatExportClause);
   kissat_set_import_call(m_solver, kissatImportClause);
   kissat_set_import_check(m_solver, kissatHasClauseToImport);
+  kissat_set_used_import_call(m_solver, kissatImportedClauseUsed);
   kissat_set_painless(m_solver, this);
   kissat_set_id(m_solver, id);
 
+  // Kissat keeps imported binaries in its watch lists, they are never reported
+  m_minTrackedSize = 3;
+
   initKissatOptions(); /* Must be called before reserve or initshuffle */
 
   initializeTypeId<Kissat>();
@@ -107,6 +118,7 @@ Kissat::solve(cube_view_t cube)
     kissat_set_export_call(m_solver, kissatExportClause);
     kissat_set_import_call(m_solver, kissatImportClause);
     kissat_set_import_check(m_solver, kissatHasClauseToImport);
+    kissat_set_used_import_call(m_solver, kissatImportedClauseUsed);
     kissat_set_painless(m_solver, this);
 
     // Set all params done for the previous instances
@@ -141,6 +153,7 @@ Kissat::solve(cube_view_t cube)
        cube.size());
 
   int res = kissat_solve(m_solver);
+  flushExports();
 
   if (res == 10) {
     LOG2("Kissat %d responded with SAT", this->getSolverId());
@@ -506,7 +519,48 @@ Kissat::importClause(const ClauseExchangePtr& clause)
 bool
 Kissat::backendHasClauseToImport()
 {
-  if (!this->m_clausesToImport->getOneClause(m_clauseToImport)) {
+  if (m_conflictingUnit)
+    return true;
+
+  flushExports();
+
+  // Units of the fast lane are assigned directly (we are at root level), a
+  // falsified one is kept for backendImportClause to end the search as UNSAT
+  if (m_unitChannel) {
+    m_unitsToImport.clear();
+    if (!pollUnits(m_unitsToImport)) {
+      lit_t conflict = m_unitChannel->getConflictLiteral();
+      m_unitsToImport.push_back(-conflict);
+      m_unitsToImport.push_back(conflict);
+    }
+    for (lit_t unit : m_unitsToImport) {
+      if (kissat_assign_punits(m_solver, &unit, 1) == 20) {
+        LOGD2("Kissat %u: fast lane unit %d is falsified at root level",
+              this->getSharingId(),
+              unit);
+        m_conflictingUnit = unit;
+        return true;
+      }
+    }
+  }
+
+  refreshRejectedLiterals(m_originalVars,
+                          kissat_get_active(m_solver),
+                          [this](unsigned char* states, unsigned vars) {
+                            kissat_get_import_rejected_plits(
+                              m_solver, states, vars);
+                          });
+
+  exchangePhases(m_originalVars,
+                 [this](signed char* phases,
+                        unsigned vars,
+                        PhaseChannel::Source source) {
+                   kissat_get_phases(
+                     m_solver, phases, vars, static_cast<int>(source));
+                 });
+
+  this->m_clausesToImport->getClauses(m_importBatch);
+  if (m_importBatch.empty()) {
     this->m_clausesToImport->shrinkDatabase();
     return false;
   }
@@ -517,25 +571,46 @@ Kissat::backendHasClauseToImport()
 bool
 Kissat::backendImportClause()
 {
-  // Returns false if this clause shouldn't be imported after checking the
-  // solver state
-  kissat_set_pglue(m_solver, m_clauseToImport->lbd);
-
-  bool willImport = kissat_import_pclause(
-    m_solver, m_clauseToImport->lits, m_clauseToImport->size);
-
-  if (willImport) {
-    if (m_clauseToImport->lbd)
-      LOGD3("Kissat %u will import redundant clause %s",
-            this->getSharingId(),
-            m_clauseToImport->toString().c_str());
-    else
-      LOGD3("Kissat %u will import irredundant clause %s",
-            this->getSharingId(),
-            m_clauseToImport->toString().c_str());
+  // A falsified unit leaves an empty clause: the learning loop returns UNSAT
+  if (m_conflictingUnit) {
+    kissat_set_pglue(m_solver, 0);
+    bool willImport = kissat_import_pclause(m_solver, &m_conflictingUnit, 1);
+    m_conflictingUnit = 0;
+    return willImport;
   }
 
-  return willImport;
+  // The whole batch is flattened and attached in a single call, the learning
+  // loop only sees its outcome
+  m_batchLiterals.clear();
+  m_batchSizes.clear();
+  m_batchGlues.clear();
+  for (const ClauseExchangePtr& clause : m_importBatch) {
+    m_batchLiterals.insert(
+      m_batchLiterals.end(), clause->begin(), clause->end());
+    m_batchSizes.push_back(clause->size);
+    m_batchGlues.push_back(clause->lbd);
+    this->trackImport(*clause);
+    LOGD3("Kissat %u will import clause %s",
+          this->getSharingId(),
+          clause->toString().c_str());
+  }
+  m_importBatch.clear();
+
+  int res = kissat_import_pclauses(m_solver,
+                                   m_batchLiterals.data(),
+                                   m_batchSizes.data(),
+                                   m_batchGlues.data(),
+                                   m_batchSizes.size());
+
+  // On an empty clause solver->clause is left empty, accepting it makes the
+  // learning loop return UNSAT
+  if (res == 20) {
+    LOGD2("Kissat %u derived the empty clause from an imported batch",
+          this->getSharingId());
+    kissat_set_pglue(m_solver, 0);
+    return true;
+  }
+  return false;
 }
 
 bool
@@ -547,6 +622,9 @@ Kissat::backendExplortClause()
 
   assert(size > 0);
 
+  if (!exportAdmissible(size + m_assumptions.size(), lbd))
+    return false;
+
   // In case there are assumptions we add their negation to have a sharable
   // clause
   m_clauseToExport.clear();
@@ -568,11 +646,11 @@ Kissat::backendExplortClause()
         this->getSharingId(),
         new_clause->toString().c_str());
 
+  if (m_clauseToExport.size() == 1)
+    publishUnit(m_clauseToExport[0]);
+
   /* filtering defined by a sharing strategy */
-  if (this->exportClause(new_clause)) {
-    return true;
-  } else
-    return false;
+  return this->stageExport(new_clause);
 }
 
 // ==================================================================
@@ -602,6 +680,13 @@ Kissat::setPhase(const var_t var, const bool phase)
   kissat_set_phase(m_solver, var, (phase) ? 1 : -1);
 }
 
+void
+Kissat::setPhaseHint(const var_t var, const bool phase)
+{
+  /* saved phase only: best and target are the published ones */
+  kissat_set_phase_hint(m_solver, var, (phase) ? 1 : -1);
+}
+
 void
 Kissat::bumpVariableActivity(const var_t var, const int times)
 {
@@ -51,11 +51,16 @@ public:
 
   /* Sharing */
   bool importClause(const ClauseExchangePtr& clause) override;
+  std::optional<size_t> getImportBacklog() const override
+  {
+    return m_clausesToImport->getSize();
+  }
 
   /* Variable Management */
   uint getVariableCount() override;
   var_t getDivisionVariable() override;
   void setPhase(const var_t var, const bool phase) override;
+  void setPhaseHint(const var_t var, const bool phase) override;
   void bumpVariableActivity(const var_t var, const int times) override;
 
   /* Result & Solution */
@@ -83,9 +88,10 @@ protected:
   void initKissatOptions();
 
   /**
-   * @brief Send an imported clause in @ref m_clausesToImport to the backend
-   * solver
-   * @return True if the clause was accepted by the backend, false otherwise
+   * @brief Send the clauses read from @ref m_clausesToImport to the backend
+   * solver as one batch
+   * @return True if the backend must learn solver->clause (an empty clause,
+   * i.e. UNSAT), false otherwise
    */
   bool backendImportClause();
 
@@ -123,8 +129,19 @@ protected:
 
   std::vector<lit_t> m_clauseToExport;
 
-  /// A pointer pointing to the next clause to be exported
-  ClauseExchangePtr m_clauseToImport;
+  /// Clauses read from @ref m_clausesToImport, imported in a single call
+  std::vector<ClauseExchangePtr> m_importBatch;
+
+  /// Flattened literals, sizes and glues of @ref m_importBatch
+  std::vector<int> m_batchLiterals;
+  std::vector<unsigned> m_batchSizes;
+  std::vector<unsigned> m_batchGlues;
+
+  /// Units read from the unit channel
+  std::vector<lit_t> m_unitsToImport;
+
+  /// Fast lane unit falsified at root level, imported as an empty clause
+  lit_t m_conflictingUnit = 0;
 
   // Kissat Backend Callbacks
   // ========================
@@ -151,4 +168,14 @@ protected:
    * @return 0 if the clause was not exported, !0 otherwise
    */
   friend char kissatExportClause(void* vpkissat);
+
+  /**
+   * @brief C Callback reporting an imported clause used in a conflict
+   * @param vpkissat pointer to the painless Kissat object
+   * @param lits external literals of the clause
+   * @param size number of literals
+   */
+  friend void kissatImportedClauseUsed(void* vpkissat,
+                                       const int* lits,
+                                       unsigned size);
 };
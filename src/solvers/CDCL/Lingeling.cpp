@@ -34,7 +34,7 @@ produceUnit(void* sp, int lit)
         ncls->toString().c_str());
 
   /* filtering defined by a sharing strategy */
-  lp->exportClause(ncls);
+  lp->stageExport(ncls);
 }
 
 void
@@ -54,6 +54,9 @@ produce(void* sp, int* cls, int glue)
     size++;
   }
 
+  if (!lp->exportAdmissible(size, glue))
+    return;
+
   ClauseExchangePtr ncls =
     ClauseExchange::create(size, glue, lp->getSharingId());
 
@@ -64,7 +67,7 @@ produce(void* sp, int* cls, int glue)
         ncls->toString().c_str());
 
   /* filtering defined by a sharing strategy */
-  lp->exportClause(ncls);
+  lp->stageExport(ncls);
 }
 
 void
@@ -72,6 +75,8 @@ consumeUnits(void* sp, int** start, int** end)
 {
   Lingeling* lp = (Lingeling*)sp;
 
+  lp->flushExports();
+
   // used a vector to a get a constant state of the units lockfree queue (to
   // check if worth it)
   std::vector<int> tmp;
@@ -297,6 +302,7 @@ Lingeling::solve(cube_view_t cube)
 
   // Solve the problem
   res = lglsat(solver);
+  flushExports();
 
   switch (res) {
     case LGL_SATISFIABLE:
@@ -48,6 +48,10 @@ public:
 
   /* Sharing */
   bool importClause(const ClauseExchangePtr& clause) override;
+  std::optional<size_t> getImportBacklog() const override
+  {
+    return m_clausesToImport->getSize();
+  }
 
   /* Variable Management */
   uint getVariableCount() override;
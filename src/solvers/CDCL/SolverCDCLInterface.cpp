@@ -1,6 +1,62 @@
 #include "SolverCDCLInterface.hpp"
+#include "utils/System.hpp"
 #include <iomanip>
 
+SolverCDCLInterface::~SolverCDCLInterface()
+{
+  if (m_prefilteredClauses || m_exportBatches) {
+    LOGSTAT("Solver %d: %lu learnt clauses dropped by the export pre-filter, "
+            "%lu export batches",
+            this->getSharingId(),
+            m_prefilteredClauses,
+            m_exportBatches);
+  }
+  if (m_rejectedLiterals) {
+    LOGSTAT("Solver %d: %lu clauses not routed to it by the import filter "
+            "(%lu refreshes)",
+            this->getSharingId(),
+            m_rejectedLiterals->getAvoided(),
+            m_importFilterRefreshes);
+  }
+  if (m_usageFeedback) {
+    LOGSTAT("Solver %d: %lu imported clauses reported as used",
+            this->getSharingId(),
+            m_usedImports);
+  }
+}
+
+bool
+SolverCDCLInterface::stageExport(const ClauseExchangePtr& clause)
+{
+  if (!m_exportBatchSize)
+    return this->exportClause(clause);
+
+  auto now = SystemResourceMonitor::Timer::getAbsoluteTimeMicro();
+  if (m_stagedExports.empty())
+    m_oldestStagedExport = now;
+
+  m_stagedExports.push_back(clause);
+  m_stagedLiterals += clause->size;
+
+  if (clause->size == 1 || m_stagedExports.size() >= m_exportBatchSize ||
+      m_stagedLiterals >= MAX_STAGED_LITERALS ||
+      now - m_oldestStagedExport >= m_exportBatchDelay)
+    flushExports();
+  return true;
+}
+
+void
+SolverCDCLInterface::flushExports()
+{
+  if (m_stagedExports.empty())
+    return;
+
+  this->exportClauses(m_stagedExports);
+  m_stagedExports.clear();
+  m_stagedLiterals = 0;
+  m_exportBatches++;
+}
+
 void
 SolverInterface::printStats(
   const std::vector<std::shared_ptr<SolverInterface>>& solvers)
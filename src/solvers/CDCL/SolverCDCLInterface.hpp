@@ -2,8 +2,12 @@
 
 #include "containers/ClauseDatabase.hpp"
 #include "sharing/SharingEntity.hpp"
+#include "sharing/UnitChannel.hpp"
 #include "solvers/SolverInterface.hpp"
 
+#include <chrono>
+#include <unordered_map>
+
 /**
  * @defgroup solving_cdcl CDCL Solvers
  * @brief Different Classes for CDCL (Conflict-Driven Clause Learning) solvers
@@ -78,7 +82,7 @@ public:
   /**
    * @brief Destructor for SolverCDCLInterface
    */
-  virtual ~SolverCDCLInterface() {}
+  virtual ~SolverCDCLInterface();
 
   // Variable Management
   // ===================
@@ -113,12 +117,256 @@ public:
    */
   SolverCDCLType getSolverType() { return this->m_cdclType; }
 
+  /**
+   * @brief Connect the solver to the unit fast lane: its root level units are
+   * published there and it polls the others' units at its import points.
+   * @warning To be set before solving
+   */
+  void setUnitChannel(const std::shared_ptr<UnitChannel>& unitChannel)
+  {
+    m_unitChannel = unitChannel;
+  }
+
+  /**
+   * @brief Stage the learnt clauses and export them in batches.
+   * @param batchSize clauses staged before a flush (0 exports each clause as
+   * it is learnt)
+   * @param batchDelay age of the oldest staged clause forcing a flush
+   * @warning To be set before solving
+   */
+  void setExportBatching(unsigned batchSize,
+                         std::chrono::microseconds batchDelay)
+  {
+    m_exportBatchSize = batchSize;
+    m_exportBatchDelay = batchDelay;
+  }
+
+  /**
+   * @brief Advertise the literals that make this solver drop an imported
+   * clause (see RejectedLiterals), refreshed at its import points.
+   * @warning To be set before solving
+   */
+  void setImportFilter(bool enabled) { m_importFilter = enabled; }
+
+  /**
+   * @brief Remember the producer of the imported redundant clauses and report
+   * the ones taking part in a conflict analysis to the clients (see
+   * SharingEntity::notifyClauseUsed).
+   * @warning To be set before solving
+   */
+  void setUsageFeedback(bool enabled) { m_usageFeedback = enabled; }
+
   static void printCDCLStats(
     const std::vector<std::shared_ptr<SolverCDCLInterface>>& solvers);
 
 protected:
+  /// Publish a learnt unit on the unit channel (no-op without channel)
+  void publishUnit(lit_t unit)
+  {
+    if (m_unitChannel)
+      m_unitChannel->publish(unit, this->getSharingId());
+  }
+
+  /**
+   * @brief Append to units the units published since the previous poll.
+   * @return false if the channel found two opposite units (UNSAT)
+   */
+  bool pollUnits(std::vector<lit_t>& units)
+  {
+    if (!m_unitChannel)
+      return true;
+    return m_unitChannel->poll(m_unitCursor,
+                               [&units](lit_t unit) { units.push_back(unit); });
+  }
+
+  /**
+   * @brief Cheap pre-filter called before creating a learnt clause: false if
+   * no client would accept it (see SharingEntity::getImportLimits).
+   * @details The clients' limits are refreshed every LIMITS_REFRESH calls,
+   * units always pass.
+   */
+  bool exportAdmissible(unsigned size, unsigned lbd)
+  {
+    if (size == 1)
+      return true;
+    if (m_exportChecks++ % LIMITS_REFRESH == 0)
+      m_clientLimits = getClientsImportLimits();
+    if (size <= m_clientLimits.size && lbd <= m_clientLimits.lbd)
+      return true;
+    m_prefilteredClauses++;
+    return false;
+  }
+
+  /**
+   * @brief Export a learnt clause, or stage it when batching is enabled. The
+   * stage is flushed once it holds m_exportBatchSize clauses or
+   * MAX_STAGED_LITERALS literals, once its oldest clause is m_exportBatchDelay
+   * old, or right away for a unit.
+   * @return true if the clause was exported or staged
+   * @note Only called by the solver thread.
+   */
+  bool stageExport(const ClauseExchangePtr& clause);
+
+  /**
+   * @brief Export the staged clauses in one batch, to be called at the import
+   * points and at the end of a solve.
+   */
+  void flushExports();
+
+  /**
+   * @brief Refresh the advertised rejected literals, called at an import point
+   * (root level) when the import filter is enabled.
+   * @param varCount variables of the formula, fixes the size of the bitmap on
+   * the first refresh
+   * @param activeVariables active variables of the backend: eliminations and
+   * root assignments lower it, nothing is done while it is unchanged
+   * @param fill fill(states, varCount) sets the states as expected by
+   * RejectedLiterals::update
+   */
+  template<typename Fill>
+  void refreshRejectedLiterals(unsigned varCount,
+                               unsigned activeVariables,
+                               Fill&& fill)
+  {
+    if (!m_importFilter || activeVariables == m_filteredActiveVariables)
+      return;
+    if (!m_rejectedLiterals) {
+      if (!varCount)
+        return;
+      m_rejectedLiterals = std::make_unique<RejectedLiterals>(varCount);
+      this->setRejectedLiterals(m_rejectedLiterals.get());
+    }
+    m_filteredActiveVariables = activeVariables;
+    m_rejectedStates.assign(m_rejectedLiterals->getVarCount() + 1, 0);
+    fill(m_rejectedStates.data(), m_rejectedLiterals->getVarCount());
+    unsigned long rejected =
+      m_rejectedLiterals->update(m_rejectedStates.data());
+    m_importFilterRefreshes++;
+    LOGD2("Solver %d advertises %lu rejected literals (%u active variables)",
+          this->getSharingId(),
+          rejected,
+          activeVariables);
+  }
+
+  /**
+   * @brief Record the producer of an imported clause (redundant, non unit),
+   * called by the solver thread when the clause is handed to the backend.
+   */
+  void trackImport(const ClauseExchange& clause)
+  {
+    if (!m_usageFeedback || clause.size < m_minTrackedSize || !clause.lbd ||
+        clause.from == this->getSharingId())
+      return;
+
+    // The oldest import is forgotten, unless it was used or imported again
+    const uint64_t key = fingerprint(clause.begin(), clause.size);
+    const size_t slot = m_trackedCount % MAX_TRACKED_IMPORTS;
+    if (m_trackedCount < MAX_TRACKED_IMPORTS) {
+      m_trackedOrder.push_back(key);
+    } else {
+      auto oldest = m_trackedImports.find(m_trackedOrder[slot]);
+      if (oldest != m_trackedImports.end() &&
+          oldest->second.order + MAX_TRACKED_IMPORTS == m_trackedCount)
+        m_trackedImports.erase(oldest);
+      m_trackedOrder[slot] = key;
+    }
+    m_trackedImports[key] = { clause.from, m_trackedCount++ };
+  }
+
+  /**
+   * @brief Called by the backend hook the first time an imported clause is
+   * used in a conflict analysis, notifies the clients with its producer.
+   * @param lits external literals of the clause (in any order)
+   * @note A clause shortened by the backend (root falsified literals) no
+   * longer matches its fingerprint and is not reported.
+   */
+  void reportUsedImport(const lit_t* lits, unsigned size)
+  {
+    if (m_trackedImports.empty())
+      return;
+    auto it = m_trackedImports.find(fingerprint(lits, size));
+    if (it == m_trackedImports.end())
+      return;
+    const int producer = it->second.producer;
+    m_trackedImports.erase(it);
+    m_usedImports++;
+    this->notifyClientsClauseUsed(producer);
+  }
+
   /// @brief Type of this CDCL solver
   SolverCDCLType m_cdclType;
+
+  /// Literals staged before a flush whatever the batch size
+  static constexpr size_t MAX_STAGED_LITERALS = 1 << 14;
+
+  /// Number of exportAdmissible calls between two refreshes of the limits
+  static constexpr unsigned long LIMITS_REFRESH = 256;
+
+  /// Export batching (see setExportBatching)
+  unsigned m_exportBatchSize = 0;
+  std::chrono::microseconds m_exportBatchDelay{ 0 };
+  std::vector<ClauseExchangePtr> m_stagedExports;
+  size_t m_stagedLiterals = 0;
+  std::chrono::microseconds m_oldestStagedExport{ 0 };
+
+  /// Cached bounds of the clients
+  SharingEntity::ImportLimits m_clientLimits;
+  unsigned long m_exportChecks = 0;
+
+  /// Export statistics
+  unsigned long m_prefilteredClauses = 0;
+  unsigned long m_exportBatches = 0;
+
+  /// Import filter (see setImportFilter)
+  bool m_importFilter = false;
+  std::unique_ptr<RejectedLiterals> m_rejectedLiterals;
+  std::vector<unsigned char> m_rejectedStates;
+  unsigned m_filteredActiveVariables = UINT_MAX;
+  unsigned long m_importFilterRefreshes = 0;
+
+  /// Usage feedback (see setUsageFeedback)
+  bool m_usageFeedback = false;
+  unsigned long m_usedImports = 0;
+
+  /// Smallest tracked import, set by the backends that never report the
+  /// smaller ones (they would only fill the map)
+  unsigned m_minTrackedSize = 2;
+
+  /// Producer and import order of the tracked clauses, by fingerprint
+  struct TrackedImport
+  {
+    int producer;
+    unsigned long order;
+  };
+  std::unordered_map<uint64_t, TrackedImport> m_trackedImports;
+
+  /// Fingerprints of the last tracked imports, order i in slot i %
+  /// MAX_TRACKED_IMPORTS
+  std::vector<uint64_t> m_trackedOrder;
+  unsigned long m_trackedCount = 0;
+
+  /// Tracked imports kept, the oldest one is forgotten beyond
+  static constexpr size_t MAX_TRACKED_IMPORTS = 1 << 18;
+
+  /// Unit fast lane, nullptr if disabled
+  std::shared_ptr<UnitChannel> m_unitChannel;
+
+  /// Position of this solver in the unit channel log
+  size_t m_unitCursor = 0;
+
+private:
+  /// Hash of a clause independent of the order of its literals
+  static uint64_t fingerprint(const lit_t* lits, unsigned size)
+  {
+    uint64_t hash = size;
+    for (unsigned i = 0; i < size; i++) {
+      uint64_t x = static_cast<uint64_t>(static_cast<int64_t>(lits[i]));
+      x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+      hash += x ^ (x >> 31);
+    }
+    return hash;
+  }
 };
 
 /**
@@ -0,0 +1,84 @@
+#include "LocalSearchGuide.hpp"
+
+LocalSearchGuide::LocalSearchGuide(std::chrono::milliseconds interval,
+                                   PhaseChannel::Source source,
+                                   bool importLearnt)
+  : m_channel(std::make_shared<PhaseChannel>())
+  , m_interval(interval)
+  , m_importLearnt(importLearnt)
+  , m_next(std::chrono::steady_clock::now() + interval)
+{
+  m_channel->setSource(source);
+  m_channel->setPeriod(interval);
+}
+
+bool
+LocalSearchGuide::importClause(const ClauseExchangePtr& clause)
+{
+  if (!m_importLearnt || clause->size > 2)
+    return false;
+
+  std::lock_guard<std::mutex> lock(m_learntMutex);
+  if (m_learnt.size() >= MAX_LEARNT_CLAUSES || !m_known.insert(clause).second)
+    return false;
+  m_learnt.push_back(clause);
+  return true;
+}
+
+bool
+LocalSearchGuide::due()
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (now < m_next)
+    return false;
+  m_next = now + m_interval;
+  return true;
+}
+
+const PhaseChannel::Phases*
+LocalSearchGuide::nextRestart(unsigned varCount)
+{
+  // The local searcher is the only reader of its channel: it aggregates it
+  m_channel->aggregate();
+  std::shared_ptr<const PhaseChannel::Phases> hint =
+    m_channel->poll(m_hintCursor);
+  if (hint) {
+    m_assignment = *hint;
+    m_hasHint = true;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_learntMutex);
+    for (; m_learntRead < m_learnt.size(); m_learntRead++) {
+      const ClauseExchangePtr& clause = m_learnt[m_learntRead];
+      (clause->size == 1 ? m_units : m_binaries).push_back(clause);
+    }
+  }
+
+  if (!m_hasHint && m_units.empty() && m_binaries.empty())
+    return nullptr;
+  m_assignment.resize(varCount + 1, 0);
+
+  // An unknown literal is left to the local searcher. Only the phases that
+  // change are counted: without a new hint, the assignment of the previous
+  // restart already satisfies the clauses
+  for (const ClauseExchangePtr& binary : m_binaries) {
+    const lit_t first = binary->lits[0];
+    const lit_t second = binary->lits[1];
+    if (std::abs(first) > varCount || std::abs(second) > varCount)
+      continue;
+    if (value(first) < 0 && value(second) < 0) {
+      assign(first);
+      m_stats.repairedBinaries++;
+    }
+  }
+  for (const ClauseExchangePtr& unit : m_units) {
+    if (std::abs(unit->lits[0]) > varCount || value(unit->lits[0]) > 0)
+      continue;
+    assign(unit->lits[0]);
+    m_stats.forcedUnits++;
+  }
+
+  m_stats.restarts++;
+  return &m_assignment;
+}
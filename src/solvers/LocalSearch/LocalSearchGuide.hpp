@@ -0,0 +1,116 @@
+#pragma once
+
+#include "containers/ClauseUtils.hpp"
+#include "sharing/PhaseChannel.hpp"
+#include "sharing/SharingEntity.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Guides a local searcher with the state of CDCL solvers (`guide`
+ * object of a local searcher in a topology file).
+ *
+ * @details The source CDCL solvers publish their target phases (the largest
+ * conflict-free trail, `trail` mode), saved phases (`phases` mode) or best
+ * phases (`best` mode) on the channel of the guide at their import points.
+ * When the interval elapsed, the local searcher takes their majority
+ * (nextRestart) and sets it as its phases, its next restart starts from them.
+ *
+ * With `import-learnt`, the guide is also a client of the sources and keeps
+ * their learnt units and binaries. A local searcher cannot add clauses once
+ * its search started, they are thus enforced on the restart assignment: the
+ * falsified binaries are repaired, then the units are set.
+ * @ingroup localsearch_solving
+ */
+class LocalSearchGuide : public SharingEntity
+{
+public:
+  /// Learnt clauses kept at most
+  static constexpr size_t MAX_LEARNT_CLAUSES = 1 << 20;
+
+  /// Counts of the guided restarts, read once solving ended
+  struct Statistics
+  {
+    unsigned long restarts = 0;
+    /// Phases changed by a unit, binaries falsified by the restart phases
+    unsigned long forcedUnits = 0;
+    unsigned long repairedBinaries = 0;
+  };
+
+  /**
+   * @param interval time between two guided restarts
+   * @param source phases published by the source solvers
+   * @param importLearnt keep the learnt units and binaries of the sources
+   */
+  LocalSearchGuide(std::chrono::milliseconds interval,
+                   PhaseChannel::Source source,
+                   bool importLearnt);
+
+  /// The channel to connect the source solvers to, as publishers
+  const std::shared_ptr<PhaseChannel>& getChannel() const { return m_channel; }
+
+  /**
+   * @brief Keeps the units and binaries of the sources (import-learnt).
+   */
+  bool importClause(const ClauseExchangePtr& clause) override;
+
+  ImportLimits getImportLimits(int producer) const override
+  {
+    return { m_importLearnt ? 2u : 0u, UINT_MAX };
+  }
+
+  /**
+   * @brief True once per interval.
+   * @note Only called by the thread of the local searcher.
+   */
+  bool due();
+
+  /**
+   * @brief The phases of the next restart: the majority of the phases
+   * published by the sources, with the learnt units and binaries enforced.
+   * @param varCount variables of the local searcher
+   * @return phase per variable (1, -1 or 0 to keep the current one), nullptr
+   * if the guide has nothing yet
+   * @note Only called by the thread of the local searcher.
+   */
+  const PhaseChannel::Phases* nextRestart(unsigned varCount);
+
+  const Statistics& getStatistics() const { return m_stats; }
+
+protected:
+  /// Value of lit in m_assignment (1, -1 or 0)
+  int value(lit_t lit) const
+  {
+    const signed char phase = m_assignment[std::abs(lit)];
+    return lit > 0 ? phase : -phase;
+  }
+
+  void assign(lit_t lit) { m_assignment[std::abs(lit)] = lit > 0 ? 1 : -1; }
+
+  std::shared_ptr<PhaseChannel> m_channel;
+  std::chrono::milliseconds m_interval;
+  const bool m_importLearnt;
+
+  /// Learnt units and binaries of the sources, without duplicates
+  std::mutex m_learntMutex;
+  std::vector<ClauseExchangePtr> m_learnt;
+  std::unordered_set<ClauseExchangePtr,
+                     ClauseUtils::ClauseExchangePtrHash,
+                     ClauseUtils::ClauseExchangePtrEqual>
+    m_known;
+
+  // Local searcher side
+  std::chrono::steady_clock::time_point m_next;
+  uint64_t m_hintCursor = 0;
+  bool m_hasHint = false;
+  size_t m_learntRead = 0;
+  std::vector<ClauseExchangePtr> m_units;
+  std::vector<ClauseExchangePtr> m_binaries;
+  PhaseChannel::Phases m_assignment;
+
+  Statistics m_stats;
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "solvers/LocalSearch/LocalSearchGuide.hpp"
 #include "solvers/SolverInterface.hpp"
 
 /**
@@ -58,7 +59,62 @@ public:
    */
   unsigned int getNumUnsats() { return this->lsStats.numberUnsatClauses; }
 
+  /**
+   * @brief Restart periodically from the state of CDCL solvers (see
+   * LocalSearchGuide).
+   * @warning To be set before solving
+   */
+  void setGuide(std::shared_ptr<LocalSearchGuide> guide)
+  {
+    m_guide = std::move(guide);
+  }
+
 protected:
+  /**
+   * @brief Set the phases of the next guided restart when the guide interval
+   * elapsed. Called from the termination callback, i.e. during the search.
+   */
+  void guideRestart()
+  {
+    if (!m_guide || !m_guide->due())
+      return;
+    const PhaseChannel::Phases* phases =
+      m_guide->nextRestart(getVariableCount());
+    if (!phases)
+      return;
+    // The phases of a previous guided restart not reached yet are replaced
+    clearPhases();
+    for (size_t var = 1; var < phases->size(); var++)
+      if ((*phases)[var])
+        setPhase(var, (*phases)[var] > 0);
+    LOGD2("LocalSearcher %d: guided restart %lu",
+          this->getSolverId(),
+          m_guide->getStatistics().restarts);
+  }
+
+  /**
+   * @brief Drop the phases given by setPhase and not applied yet (they are
+   * queued until the next restart), nothing by default.
+   */
+  virtual void clearPhases() {}
+
+  /// Log the guide statistics at the end of a run
+  void logGuideStatistics()
+  {
+    if (!m_guide)
+      return;
+    const LocalSearchGuide::Statistics& stats = m_guide->getStatistics();
+    LOGSTAT("[LocalSearcher %d] guided restarts: %lu, forced units: %lu, "
+            "repaired binaries: %lu",
+            this->getSolverId(),
+            stats.restarts,
+            stats.forcedUnits,
+            stats.repairedBinaries);
+  }
+
+  /// See setGuide
+  std::shared_ptr<LocalSearchGuide> m_guide;
+
   /// @brief Type of the local search
   LocalSearchType lsType;
 
@@ -20,8 +20,8 @@ TaSSAT::TaSSAT(int _id,
       TaSSAT* cppWrapper = reinterpret_cast<TaSSAT*>(cpp);
       if (cppWrapper->terminateSolver)
         return 1;
-      else
-        return 0;
+      cppWrapper->guideRestart();
+      return 0;
     },
     this);
 }
@@ -46,8 +46,8 @@ TaSSAT::TaSSAT(int _id,
       TaSSAT* cppWrapper = reinterpret_cast<TaSSAT*>(cpp);
       if (cppWrapper->terminateSolver)
         return 1;
-      else
-        return 0;
+      cppWrapper->guideRestart();
+      return 0;
     },
     this);
 
@@ -134,16 +134,26 @@ TaSSAT::solve(cube_view_t cube)
   if (result == SatAnswer::SAT)
     return result;
 
+  applyPhaseHints(getVariableCount());
+
   int res = tass_sat(this->solver);
 
   this->lsStats.numberUnsatClauses = tass_nunsat_external(solver);
 
+  publishPhases(getVariableCount(),
+                tass_minimum(solver),
+                [this](signed char* phases, unsigned vars, auto) {
+                  for (unsigned var = 1; var <= vars; var++)
+                    phases[var] = tass_deref(this->solver, var) > 0 ? 1 : -1;
+                });
+
   LOGSTAT(
     "[TaSSAT %u] finished with %u tries, %lld flips, and %d remaining unsats",
     this->getSolverTypeId(),
     1,
     tass_flips(solver),
     tass_minimum(solver));
+  logGuideStatistics();
 
   return static_cast<SatAnswer>(res);
 }
@@ -154,6 +164,12 @@ TaSSAT::setPhase(const var_t var, const bool phase)
   tass_setphase(this->solver, (phase) ? var : -var);
 }
 
+void
+TaSSAT::clearPhases()
+{
+  tass_clearphases(this->solver);
+}
+
 bool
 TaSSAT::addClause(clause_view_t clause)
 {
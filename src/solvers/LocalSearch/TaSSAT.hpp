@@ -85,6 +85,8 @@ public:
   // getClauseWeights();
 
 private:
+  void clearPhases() override;
+
   void setOption(const std::string& key, int value) override;
   void setOption(const std::string& key, double value) override;
 
@@ -11,8 +11,9 @@ YalSAT_terminate(void* p_yalsat)
   YalSAT* cpp_yalsat = (YalSAT*)p_yalsat;
   if (cpp_yalsat->terminateSolver)
     return 1;
-  else
-    return 0;
+  // The termination check is the periodic hook of the search
+  cpp_yalsat->guideRestart();
+  return 0;
 }
 
 YalSAT::YalSAT(int _id, FullClauseReader fullReader)
@@ -103,16 +104,26 @@ YalSAT::solve(cube_view_t cube)
        readClauses,
        cube.size());
 
+  applyPhaseHints(getVariableCount());
+
   res = yals_sat(this->solver);
 
   this->lsStats.numberFlips = yals_flips(this->solver);
   this->lsStats.numberUnsatClauses = yals_minimum(this->solver);
 
+  publishPhases(getVariableCount(),
+                this->lsStats.numberUnsatClauses,
+                [this](signed char* phases, unsigned vars, auto) {
+                  for (unsigned var = 1; var <= vars; var++)
+                    phases[var] = yals_deref(this->solver, var) > 0 ? 1 : -1;
+                });
+
   LOGSTAT("[YalSAT %d] Number of remaining unsats %d / %d, Number of Flips %d.",
           this->getSolverId(),
           this->lsStats.numberUnsatClauses,
           this->clausesCount,
           this->lsStats.numberFlips);
+  logGuideStatistics();
 
   if (static_cast<int>(SatAnswer::SAT) != res) {
     return SatAnswer::UNKNOWN;
@@ -139,6 +150,12 @@ YalSAT::setPhase(const var_t var, const bool phase)
   yals_setphase(this->solver, (phase) ? var : -var);
 }
 
+void
+YalSAT::clearPhases()
+{
+  yals_clearphases(this->solver);
+}
+
 bool
 YalSAT::addClause(clause_view_t clause)
 {
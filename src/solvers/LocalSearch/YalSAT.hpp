@@ -58,6 +58,8 @@ public:
   friend int YalSAT_terminate(void* p_yalsat);
 
 private:
+  void clearPhases() override;
+
   void setOption(const std::string& key, int value) override;
   void setOption(const std::string& key, double value) override;
 
@@ -8,13 +8,17 @@
 #include <painless/solver.hpp>
 
 #include "containers/CSRMatrix.hpp"
+#include "containers/CompressedCSRMatrix.hpp"
 #include "containers/ClauseExchange.hpp"
 #include "containers/ClauseUtils.hpp"
 
 #include "utils/Logger.hpp"
 #include "config/Configurable.hpp"
+#include "sharing/PhaseChannel.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <random>
 #include <stdio.h>
@@ -40,6 +44,7 @@ using SeedGenerator = std::function<int(SolverInterface*)>;
 using ClauseReader = std::function<bool(clause_view_t)>;
 using FullClauseReader = std::function<uint(ClauseReader, uint)>;
 using formula_t = pl::csr_matrix_t<lit_t>;
+using compressed_formula_t = pl::compressed_csr_matrix_t<lit_t>;
 
 /**
  * @brief Interface for a SAT solver with standard features.
@@ -160,6 +165,18 @@ public:
    */
   virtual void setPhase(const var_t var, const bool phase) = 0;
 
+  /**
+   * @brief Set the phase of a variable from a phase channel hint, setPhase
+   * by default. The solvers publishing phases override it to keep the hints
+   * out of the phases they publish.
+   * @param var Variable identifier
+   * @param phase Boolean phase to set
+   */
+  virtual void setPhaseHint(const var_t var, const bool phase)
+  {
+    setPhase(var, phase);
+  }
+
   // Result & Solution
   // =================
 
@@ -232,6 +249,36 @@ public:
    */
   void setSolverId(plid_t id) { this->m_solverId = id; }
 
+  /**
+   * @brief Cpus the thread running this solver is restricted to (empty: no
+   * restriction).
+   * @warning To be set before the working strategy creates its threads
+   */
+  void setCpuAffinity(std::vector<int> cpus)
+  {
+    m_cpuAffinity = std::move(cpus);
+  }
+
+  const std::vector<int>& getCpuAffinity() const { return m_cpuAffinity; }
+
+  /**
+   * @brief Connect the solver to a phase channel (see PhaseSharing and
+   * LocalSearchGuide), a solver may be connected to several of them.
+   * @param publish the solver contributes its phases
+   * @param apply the solver takes the aggregated phases as hints
+   * @warning To be called before solving
+   */
+  void addPhaseChannel(std::shared_ptr<PhaseChannel> channel,
+                       bool publish,
+                       bool apply)
+  {
+    PhaseLink link;
+    link.slot = publish ? channel->join() : -1;
+    link.apply = apply;
+    link.channel = std::move(channel);
+    m_phaseLinks.push_back(std::move(link));
+  }
+
   /**
    * @brief Get the current count of instances of this object's most-derived
    * type.
@@ -288,11 +335,103 @@ protected:
           m_solverTypeId);
   }
 
+  /**
+   * @brief Exchange the phases with the channels whose period elapsed, for the
+   * solvers calling it at frequent points (e.g. CDCL import points).
+   * @param fill see publishPhases
+   */
+  template<typename Fill>
+  void exchangePhases(unsigned varCount, Fill&& fill)
+  {
+    if (m_phaseLinks.empty())
+      return;
+    const auto now = std::chrono::steady_clock::now();
+    for (PhaseLink& link : m_phaseLinks) {
+      if (now < link.next)
+        continue;
+      link.next = now + link.channel->getPeriod();
+      publishTo(link, varCount, PhaseChannel::NO_UNSAT_COUNT, fill);
+      applyFrom(link, varCount);
+    }
+  }
+
+  /**
+   * @brief Publish the phases of the solver to the channels it contributes to.
+   * @param unsatCount see PhaseChannel::publish
+   * @param fill fill(phases, varCount, source) sets phases[1..varCount] to 1,
+   * -1 or 0, source is the PhaseChannel::Source of the channel
+   */
+  template<typename Fill>
+  void publishPhases(unsigned varCount, unsigned unsatCount, Fill&& fill)
+  {
+    for (PhaseLink& link : m_phaseLinks)
+      publishTo(link, varCount, unsatCount, fill);
+  }
+
+  /**
+   * @brief Set the phases of the new hints through setPhaseHint, from the
+   * channels the solver takes hints from.
+   */
+  void applyPhaseHints(unsigned varCount)
+  {
+    for (PhaseLink& link : m_phaseLinks)
+      applyFrom(link, varCount);
+  }
+
 protected:
   SolverInterface::Type m_algoType; /**< Algorithm family of this solver. */
   std::atomic<bool> m_initialized;  /**< Initialization status. */
   plid_t m_solverTypeId;            /**< ID local to the solver type. */
   plid_t m_solverId;                /**< Main ID of the solver. */
+  std::vector<int> m_cpuAffinity;   /**< See setCpuAffinity. */
+
+  /// Phase sharing (see addPhaseChannel)
+  struct PhaseLink
+  {
+    std::shared_ptr<PhaseChannel> channel;
+
+    /// Contributor slot, -1 if the solver does not publish
+    int slot = -1;
+
+    bool apply = false;
+
+    /// Version of the last hint read
+    uint64_t cursor = 0;
+
+    /// Next exchange of exchangePhases
+    std::chrono::steady_clock::time_point next;
+  };
+  std::vector<PhaseLink> m_phaseLinks;
+  PhaseChannel::Phases m_phaseBuffer;
+  unsigned long m_appliedPhaseHints = 0;
+
+  template<typename Fill>
+  void publishTo(PhaseLink& link,
+                 unsigned varCount,
+                 unsigned unsatCount,
+                 Fill& fill)
+  {
+    if (link.slot < 0 || !varCount)
+      return;
+    m_phaseBuffer.assign(varCount + 1, 0);
+    fill(m_phaseBuffer.data(), varCount, link.channel->getSource());
+    link.channel->publish(link.slot, m_phaseBuffer, unsatCount);
+  }
+
+  void applyFrom(PhaseLink& link, unsigned varCount)
+  {
+    if (!link.apply)
+      return;
+    std::shared_ptr<const PhaseChannel::Phases> hint =
+      link.channel->poll(link.cursor);
+    if (!hint)
+      return;
+    const size_t vars = std::min<size_t>(varCount + 1, hint->size());
+    for (size_t var = 1; var < vars; var++)
+      if ((*hint)[var])
+        setPhaseHint(var, (*hint)[var] > 0);
+    m_appliedPhaseHints++;
+  }
 
   /**
    * @brief Number of existing instances of derived classes.
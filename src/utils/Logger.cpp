@@ -1,4 +1,5 @@
 #include "utils/Logger.hpp"
+#include "utils/ModelWriter.hpp"
 #include "utils/System.hpp"
 
 #include <stdarg.h>
@@ -155,37 +156,13 @@ Logger::logSolution(const char* string)
   }
 }
 
-static unsigned int
-intWidth(int i)
-{
-  if (i == 0)
-    return 1;
-
-  return (i < 0) + 1 + (unsigned int)log10(fabs(i));
-}
-
 void
-Logger::logModel(model_view_t model)
+Logger::logModel(model_view_t model, unsigned threadCount)
 {
   if (!m_isQuiet) {
     LOCK_GUARD(std::recursive_mutex, m_logMutex, lockLog);
-    unsigned int usedWidth = 0;
-
-    for (unsigned int i = 0; i < model.size(); i++) {
-      if (usedWidth + 1 + intWidth(model[i]) > 80) {
-        printf("\n");
-        usedWidth = 0;
-      }
-
-      if (usedWidth == 0) {
-        usedWidth += printf("v");
-      }
-
-      usedWidth += printf(" %d", model[i]);
-    }
-
-    printf(" 0");
-
-    printf("\n");
+    // The model bypasses stdio, pending printf output must go first
+    fflush(stdout);
+    ModelWriter::writeModel(STDOUT_FILENO, model, threadCount);
   }
-}
\ No newline at end of file
+}
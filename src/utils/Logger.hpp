@@ -117,8 +117,9 @@ public:
   /**
    * @brief Log the model (satisfying assignment) found by the SAT solver.
    * @param model A vector of integers representing the satisfying assignment.
+   * @param threadCount Threads formatting the "v" lines (see ModelWriter).
    */
-  void logModel(model_view_t model);
+  void logModel(model_view_t model, unsigned threadCount = 1);
 
   static Logger& getInstance();
 
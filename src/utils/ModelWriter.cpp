@@ -0,0 +1,180 @@
+#include "utils/ModelWriter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace ModelWriter {
+
+/// Width of the " 0" ending the last "v" line, kept with the last literal
+static constexpr size_t TERMINATOR_WIDTH = 2;
+
+static bool
+writeAll(int fd, const char* data, size_t size)
+{
+  while (size > 0) {
+    ssize_t written = ::write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    data += written;
+    size -= written;
+  }
+  return true;
+}
+
+/**
+ * Formats "v" lines in a buffer. With a valid fd the buffer is written each
+ * time it is full, otherwise (fd < 0) it grows and keeps everything.
+ */
+class LineEmitter
+{
+public:
+  LineEmitter(int fd, size_t capacity)
+    : m_fd(fd)
+    , m_buffer(capacity)
+  {
+  }
+
+  /**
+   * Append a literal, on a new line if it does not fit in 80 columns with
+   * the trailing characters that must follow it on the same line.
+   */
+  void literal(lit_t lit, size_t trailing = 0)
+  {
+    // Digits are produced backward at the end of tmp
+    char tmp[16];
+    char* end = tmp + sizeof(tmp);
+    char* p = end;
+    unsigned value = lit < 0 ? 0u - static_cast<unsigned>(lit) : lit;
+    do {
+      *--p = static_cast<char>('0' + value % 10);
+      value /= 10;
+    } while (value);
+    if (lit < 0)
+      *--p = '-';
+    size_t length = end - p;
+
+    reserve(length + 3);
+    if (m_width && m_width + 1 + length + trailing > 80)
+      newLine();
+    if (!m_width) {
+      m_buffer[m_used++] = 'v';
+      m_width = 1;
+    }
+    m_buffer[m_used++] = ' ';
+    std::memcpy(&m_buffer[m_used], p, length);
+    m_used += length;
+    m_width += 1 + length;
+  }
+
+  void newLine()
+  {
+    reserve(1);
+    m_buffer[m_used++] = '\n';
+    m_width = 0;
+  }
+
+  bool flush()
+  {
+    m_ok = m_ok && writeAll(m_fd, m_buffer.data(), m_used);
+    m_used = 0;
+    return m_ok;
+  }
+
+  const char* data() const { return m_buffer.data(); }
+  size_t size() const { return m_used; }
+
+private:
+  void reserve(size_t needed)
+  {
+    if (m_used + needed <= m_buffer.size())
+      return;
+    if (m_fd >= 0)
+      flush();
+    else
+      m_buffer.resize(std::max(2 * m_buffer.size(), m_used + needed));
+  }
+
+  int m_fd;
+  std::vector<char> m_buffer;
+  size_t m_used = 0;
+  size_t m_width = 0;
+  bool m_ok = true;
+};
+
+bool
+writeModel(int fd, model_view_t model, unsigned threadCount)
+{
+  threadCount = std::clamp<size_t>(
+    model.size() / MIN_LITERALS_PER_THREAD, 1, std::max(1u, threadCount));
+
+  if (threadCount == 1) {
+    LineEmitter emitter(fd, BUFFER_SIZE);
+    for (size_t i = 0; i < model.size(); i++)
+      emitter.literal(model[i], i + 1 == model.size() ? TERMINATOR_WIDTH : 0);
+    emitter.literal(0);
+    emitter.newLine();
+    return emitter.flush();
+  }
+
+  // Each thread formats its chunk in memory, starting its own "v" lines, then
+  // the chunks are written in order
+  std::vector<LineEmitter> chunks(threadCount, LineEmitter(-1, BUFFER_SIZE));
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < threadCount; t++) {
+    threads.emplace_back([&, t]() {
+      size_t begin = model.size() * t / threadCount;
+      size_t end = model.size() * (t + 1) / threadCount;
+      for (size_t i = begin; i < end; i++)
+        chunks[t].literal(model[i],
+                          i + 1 == model.size() ? TERMINATOR_WIDTH : 0);
+      if (t == threadCount - 1)
+        chunks[t].literal(0);
+      chunks[t].newLine();
+    });
+  }
+
+  bool ok = true;
+  for (unsigned t = 0; t < threadCount; t++) {
+    threads[t].join();
+    for (size_t offset = 0; ok && offset < chunks[t].size();
+         offset += BUFFER_SIZE) {
+      ok = writeAll(fd,
+                    chunks[t].data() + offset,
+                    std::min(BUFFER_SIZE, chunks[t].size() - offset));
+    }
+  }
+  return ok;
+}
+
+bool
+writeBinaryModel(const char* path, model_view_t model)
+{
+  int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    return false;
+
+  const uint64_t varCount = model.size();
+  std::vector<char> buffer(8 + sizeof(varCount) + (varCount + 7) / 8, 0);
+  std::memcpy(buffer.data(), "PLMODEL1", 8);
+  std::memcpy(buffer.data() + 8, &varCount, sizeof(varCount));
+
+  unsigned char* bits =
+    reinterpret_cast<unsigned char*>(buffer.data() + 8 + sizeof(varCount));
+  for (size_t i = 0; i < varCount; i++) {
+    if (model[i] > 0)
+      bits[i / 8] |= 1u << (i % 8);
+  }
+
+  bool ok = writeAll(fd, buffer.data(), buffer.size());
+  return (::close(fd) == 0) && ok;
+}
+
+} // namespace ModelWriter
@@ -0,0 +1,50 @@
+/**
+ * @file ModelWriter.hpp
+ * @brief Functions writing (large) models without going through printf.
+ */
+
+#pragma once
+
+#include "painless/types.hpp"
+
+/**
+ * @ingroup utils
+ * @brief Model emitters: literals are formatted by hand in large buffers that
+ * are written with a single write(2) each.
+ */
+namespace ModelWriter {
+
+/// Size of the buffers filled before each write
+constexpr size_t BUFFER_SIZE = 1 << 20;
+
+/// Minimum number of literals formatted by a thread
+constexpr size_t MIN_LITERALS_PER_THREAD = 1 << 20;
+
+/**
+ * @brief Write a model as DIMACS "v" lines of at most 80 characters, ended by
+ * " 0".
+ * @param fd the file descriptor to write to
+ * @param model the model to write
+ * @param threadCount number of threads formatting disjoint chunks of the model
+ * (each chunk starts a new "v" line), the writes stay ordered
+ * @return false if a write failed
+ */
+bool
+writeModel(int fd, model_view_t model, unsigned threadCount = 1);
+
+/**
+ * @brief Write a model in binary form for machine consumers.
+ *
+ * Layout (little endian on the usual targets, the host order is used):
+ * - 8 bytes: "PLMODEL1"
+ * - uint64_t: variable count n
+ * - (n + 7) / 8 bytes: bit i - 1 of the stream set iff variable i is true
+ *
+ * @param path the file to create or truncate
+ * @param model the model to write, model[i] being the literal of var i + 1
+ * @return false if the file could not be written
+ */
+bool
+writeBinaryModel(const char* path, model_view_t model);
+
+} // namespace ModelWriter
@@ -0,0 +1,122 @@
+#include "utils/Numa.hpp"
+#include "utils/Logger.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sched.h>
+#include <sstream>
+#include <thread>
+
+namespace pl::numa {
+
+std::vector<int>
+parseCpuList(const std::string& cpuList)
+{
+  std::vector<int> cpus;
+  std::stringstream ranges(cpuList);
+  std::string range;
+  while (std::getline(ranges, range, ',')) {
+    range.erase(std::remove_if(range.begin(), range.end(), ::isspace),
+                range.end());
+    if (range.empty())
+      continue;
+    try {
+      size_t dash = range.find('-');
+      int first = std::stoi(range.substr(0, dash));
+      int last =
+        dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+      if (first < 0 || last < first)
+        return {};
+      for (int cpu = first; cpu <= last; cpu++)
+        cpus.push_back(cpu);
+    } catch (const std::logic_error&) {
+      return {};
+    }
+  }
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+/// Cpus the process may run on
+static std::vector<int>
+allowedCpus()
+{
+  std::vector<int> cpus;
+  cpu_set_t mask;
+  if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+      if (CPU_ISSET(cpu, &mask))
+        cpus.push_back(cpu);
+  }
+  if (cpus.empty()) {
+    for (unsigned cpu = 0; cpu < std::thread::hardware_concurrency(); cpu++)
+      cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+std::vector<Node>
+readNodes(const std::string& sysfsRoot)
+{
+  namespace fs = std::filesystem;
+
+  const std::vector<int> allowed = allowedCpus();
+  std::vector<Node> nodes;
+
+  std::error_code error;
+  for (const auto& entry : fs::directory_iterator(sysfsRoot, error)) {
+    const std::string name = entry.path().filename().string();
+    if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+        !std::all_of(name.begin() + 4, name.end(), ::isdigit))
+      continue;
+
+    std::ifstream cpuListFile(entry.path() / "cpulist");
+    std::string cpuList;
+    if (!cpuListFile || !std::getline(cpuListFile, cpuList))
+      continue;
+
+    Node node{ std::stoi(name.substr(4)), {} };
+    for (int cpu : parseCpuList(cpuList))
+      if (std::binary_search(allowed.begin(), allowed.end(), cpu))
+        node.cpus.push_back(cpu);
+    if (!node.cpus.empty())
+      nodes.push_back(std::move(node));
+  }
+
+  if (nodes.empty()) {
+    LOGWARN("No NUMA layout readable in %s, assuming a single node",
+            sysfsRoot.c_str());
+    return { Node{ 0, allowed } };
+  }
+
+  std::sort(nodes.begin(), nodes.end(), [](const Node& a, const Node& b) {
+    return a.id < b.id;
+  });
+  for (const Node& node : nodes)
+    LOGD1("NUMA node %d: %zu cpus", node.id, node.cpus.size());
+  return nodes;
+}
+
+std::vector<int>
+placeThread(const std::vector<Node>& nodes, bool scatter, size_t rank)
+{
+  if (scatter) {
+    const Node& node = nodes[rank % nodes.size()];
+    return { node.cpus[(rank / nodes.size()) % node.cpus.size()] };
+  }
+
+  size_t cpuCount = 0;
+  for (const Node& node : nodes)
+    cpuCount += node.cpus.size();
+  rank %= cpuCount;
+  for (const Node& node : nodes) {
+    if (rank < node.cpus.size())
+      return { node.cpus[rank] };
+    rank -= node.cpus.size();
+  }
+  return {};
+}
+
+} // namespace pl::numa
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Machine layout as seen by the process: NUMA nodes and their cpus.
+ * @ingroup utils
+ */
+namespace pl::numa {
+
+/// A NUMA node and the cpus of the process affinity mask it holds
+struct Node
+{
+  int id;
+  std::vector<int> cpus;
+};
+
+/**
+ * @brief Parse a kernel cpu list ("0-3,8,10-11").
+ * @return the cpus in increasing order, empty on a malformed list
+ */
+std::vector<int>
+parseCpuList(const std::string& cpuList);
+
+/**
+ * @brief Read the NUMA nodes from sysfsRoot (node<N>/cpulist entries).
+ * @details Only the cpus of the process affinity mask are kept and nodes left
+ * without cpu (memory only, or outside the cpuset) are dropped. Without a
+ * readable layout, a single node 0 holding the allowed cpus is returned.
+ * @return nodes ordered by id, never empty
+ */
+std::vector<Node>
+readNodes(const std::string& sysfsRoot = "/sys/devices/system/node");
+
+/**
+ * @brief Cpu of the rank-th pinned thread of an automatic placement.
+ * @details compact fills the cpus of a node before moving to the next one,
+ * scatter deals the threads to the nodes in turn. Past the last cpu the
+ * placement wraps around.
+ * @return a single cpu
+ */
+std::vector<int>
+placeThread(const std::vector<Node>& nodes, bool scatter, size_t rank);
+
+} // namespace pl::numa
@@ -8,38 +8,116 @@
 #include "ErrorCodes.hpp"
 #include "Logger.hpp"
 #include "NumericConstants.hpp"
-#include <unordered_set>
+#include "xxhash64.hpp"
 
 namespace Parsers {
+
+static inline size_t
+literalIndex(int lit)
+{
+  return lit < 0 ? 2 * static_cast<size_t>(-lit) + 1
+                 : 2 * static_cast<size_t>(lit);
+}
+
+static inline uint64_t
+hashClause(const lit_t* lits, size_t size)
+{
+  return XXHash64::hash(lits, size * sizeof(lit_t), 0);
+}
+
 bool
 RedundancyFilter::initMembers(unsigned int varCount, unsigned int clauseCount)
 {
+  // Load factor kept under 1/2
+  size_t capacity = 16;
+  while (capacity < 2 * static_cast<size_t>(clauseCount))
+    capacity <<= 1;
+  m_table.assign(capacity, 0);
+  m_usedSlots = 0;
+  m_store.clear();
   return true;
 }
 
+void
+RedundancyFilter::grow()
+{
+  std::vector<uint64_t> oldTable(std::max<size_t>(16, 2 * m_table.size()), 0);
+  std::swap(m_table, oldTable);
+  const size_t mask = m_table.size() - 1;
+
+  for (uint64_t slot : oldTable) {
+    if (!slot)
+      continue;
+    size_t offset = (slot & OFFSET_MASK) - 1;
+    uint64_t hash = hashClause(&m_store[offset + 1], m_store[offset]);
+    size_t pos = hash & mask;
+    while (m_table[pos])
+      pos = (pos + 1) & mask;
+    m_table[pos] = slot;
+  }
+}
+
 bool
 RedundancyFilter::operator()(clause_t& clause)
 {
   std::sort(clause.begin(), clause.end());
   auto newLast = std::unique(clause.begin(), clause.end());
   clause.erase(newLast, clause.end());
-  return clauseCache.insert(clause).second;
+
+  if (2 * (m_usedSlots + 1) > m_table.size())
+    grow();
+
+  const uint64_t hash = hashClause(clause.data(), clause.size());
+  const uint64_t fingerprint = hash & ~OFFSET_MASK;
+  const size_t mask = m_table.size() - 1;
+
+  size_t pos = hash & mask;
+  for (; m_table[pos]; pos = (pos + 1) & mask) {
+    uint64_t slot = m_table[pos];
+    if ((slot & ~OFFSET_MASK) != fingerprint)
+      continue;
+    size_t offset = (slot & OFFSET_MASK) - 1;
+    if (static_cast<size_t>(m_store[offset]) == clause.size() &&
+        std::equal(clause.begin(), clause.end(), &m_store[offset + 1]))
+      return false;
+  }
+
+  size_t offset = m_store.size();
+  PABORTIF(offset + 1 > OFFSET_MASK,
+           PERR_PARSING,
+           "RedundancyFilter store is full (%zu literals)",
+           offset);
+  m_store.push_back(static_cast<lit_t>(clause.size()));
+  m_store.insert(m_store.end(), clause.begin(), clause.end());
+  m_table[pos] = fingerprint | (offset + 1);
+  m_usedSlots++;
+  return true;
 }
 
 bool
 TautologyFilter::initMembers(unsigned int varCount, unsigned int clauseCount)
 {
+  m_stamps.assign(2 * (static_cast<size_t>(varCount) + 1), 0);
+  m_generation = 0;
   return true;
 }
 
 bool
 TautologyFilter::operator()(clause_t& clause)
 {
-  std::unordered_set<int> literals;
+  if (++m_generation == 0) {
+    std::fill(m_stamps.begin(), m_stamps.end(), 0);
+    m_generation = 1;
+  }
+
   for (int lit : clause) {
-    if (literals.count(-lit) != 0)
+    size_t idx = literalIndex(lit);
+    // The header may announce less variables than used
+    if ((idx | 1) >= m_stamps.size())
+      m_stamps.resize((idx | 1) + 1, 0);
+    if (m_stamps[idx ^ 1] == m_generation)
       return false;
-    literals.insert(lit);
+    m_stamps[idx] = m_generation;
   }
   return true;
 }
@@ -53,6 +53,15 @@ public:
  * @brief Filter for removing redundant clauses.
  *
  * RedundancyFilter checks for and removes duplicate clauses during parsing.
+ * The kept clauses are appended to a flat [size][lits]... store, and an open
+ * addressing table of 64-bit slots (hash fingerprint and store offset) indexes
+ * them. No allocation is done per clause.
+ *
+ * The store is owned by the filter rather than pointing into the formula:
+ * the filter compares normalized clauses (sorted, without duplicate
+ * literals), the parser hands the kept clauses to a per-literal callback
+ * that may encode them (see compressed_csr_matrix_t) or give them straight to
+ * a solver, and a later processor may still reject a clause.
  */
 class RedundancyFilter : public ClauseProcessor
 {
@@ -77,7 +86,19 @@ public:
   bool operator()(clause_t& clause) override;
 
 private:
-  mutable std::unordered_set<clause_t, ClauseUtils::ClauseHash> clauseCache;
+  /// Double the table and reinsert the stored clauses
+  void grow();
+
+  /// Bits of a slot used by the store offset (+1, 0 is an empty slot)
+  static constexpr unsigned OFFSET_BITS = 40;
+  static constexpr uint64_t OFFSET_MASK = (uint64_t(1) << OFFSET_BITS) - 1;
+
+  /// Kept clauses: [size][lit]...[size][lit]... with sorted literals
+  std::vector<lit_t> m_store;
+
+  /// Slots: fingerprint (high bits of the hash) | store offset + 1
+  std::vector<uint64_t> m_table;
+  size_t m_usedSlots = 0;
 };
 
 /**
@@ -102,11 +123,18 @@ public:
    * @brief Check if a clause is a tautology.
    *
    * This method checks if the clause contains both a literal and its negation.
+   * A literal is marked as seen by writing the current clause generation in
+   * its stamp, so nothing has to be cleared between clauses.
    *
    * @param clause The clause to check.
    * @return true if the clause is not a tautology, false if it is.
    */
   bool operator()(clause_t& clause) override;
+
+private:
+  /// Last generation each literal (2 * var + sign) was seen in
+  std::vector<unsigned> m_stamps;
+  unsigned m_generation = 0;
 };
 
 /**
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <pthread.h>
+#include <sched.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 
+#include <vector>
+
 #define TESTRUN(cmd, msg)                                                      \
   int res = cmd;                                                               \
   if (res != 0) {                                                              \
@@ -53,6 +56,26 @@ protected:
   pthread_mutex_t mtx;
 };
 
+/**
+ * @brief Restrict a thread to a set of cpus.
+ * @return false if cpus is empty or the kernel refused the set (e.g. a cpu
+ * outside the cpuset of the process)
+ */
+inline bool
+setThreadAffinity(pthread_t thread, const std::vector<int>& cpus)
+{
+  if (cpus.empty())
+    return false;
+
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  for (int cpu : cpus)
+    if (cpu >= 0 && cpu < CPU_SETSIZE)
+      CPU_SET(cpu, &cpuset);
+
+  return pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuset) == 0;
+}
+
 /// Thread class
 class Thread
 {
@@ -75,6 +98,12 @@ public:
     pthread_setaffinity_np(this->myTid, sizeof(cpu_set_t), &cpuset);
   }
 
+  /// Restrict the thread to cpus, see ::setThreadAffinity
+  bool setThreadAffinity(const std::vector<int>& cpus)
+  {
+    return ::setThreadAffinity(this->myTid, cpus);
+  }
+
 protected:
   /// The id of the pthread.
   pthread_t myTid;
@@ -137,7 +137,15 @@ PortfolioSimple::join(WorkingStrategy* strat,
                       SatAnswer res,
                       const std::vector<int>& model)
 {
-  // Return if terminated, or already joined
+  // Return if terminated, or already joined: a late model is not verified
+  if (strategyJoined.load())
+    return;
+
+  // A wrong model must not end the portfolio: the other workers go on
+  if (parent == NULL && res == SatAnswer::SAT && !m_manager.verifyModel(model))
+    return;
+
+  // Another worker may have joined during the verification
   if (strategyJoined.exchange(true))
     return;
 
@@ -78,6 +78,10 @@ SequentialWorker::SequentialWorker(PainlessImpl& manager,
   pthread_cond_init(&mutexCondStart, NULL);
 
   worker = new Thread(mainWorker, this);
+
+  if (!solver->getCpuAffinity().empty() &&
+      !worker->setThreadAffinity(solver->getCpuAffinity()))
+    LOGWARN("Could not pin the worker of solver %d", solver->getSolverId());
 }
 
 // Destructor
@@ -125,6 +129,10 @@ SequentialWorker::join(WorkingStrategy* winner,
   }
 
   if (parent == NULL) {
+    // A result pushed once solving ends is dropped, it is not verified
+    if (res == SatAnswer::SAT && !m_manager.shouldEndSolving() &&
+        !m_manager.verifyModel(model))
+      return;
     if (m_manager.pushResult(res, model))
       this->terminate();
   } else {